@@ -3,8 +3,9 @@
  * @brief Implementation of advanced solving techniques
  *
  * This file implements sophisticated Sudoku solving techniques including
- * naked singles, hidden singles, naked pairs, hidden pairs, and locked
- * candidates for puzzle analysis and hint generation.
+ * naked singles, hidden singles, naked pairs, hidden pairs, locked
+ * candidates and alternating inference chains for puzzle analysis and hint
+ * generation.
  *
  * @author Salah-Eldin Hassen
  * @date December 2025
@@ -13,6 +14,7 @@
  */
 
 #include "SudokuAdvancedChecks.hpp"
+#include "SudokuBitboard.hpp"
 #include <sstream>
 
 // =================================================
@@ -20,6 +22,13 @@
 // =================================================
 
 SudokuAdvancedChecks::SudokuAdvancedChecks()
+    : m_candidates{}
+    , m_rules()
+    , m_links{}
+    , m_pathStart{}
+    , m_pathTarget{}
+    , m_pathServed(0)
+    , m_pathValid(false)
 {
 }
 
@@ -28,46 +37,43 @@ SudokuAdvancedChecks::~SudokuAdvancedChecks()
 }
 
 // =================================================
-// Hint Generation Methods
+// Variant Rules
 // =================================================
 
-bool SudokuAdvancedChecks::findHint(const SudokuBoard& board, SudokuHint& hint)
+void SudokuAdvancedChecks::setRuleSet(const SudokuRuleSet& rules)
 {
     // ------------------------------------------------------
-    // Calculate candidates for all empty cells
+    // Candidates, links and the cached path all follow the units
     // ------------------------------------------------------
-    calculateCandidates(board);
-    
+    m_rules = rules;
+    m_pathValid = false;
+}
+
+// =================================================
+// Hint Generation Methods
+// =================================================
+
+bool SudokuAdvancedChecks::findHint(const SudokuBoard& board, SudokuHint& hint)
+{
     // ------------------------------------------------------
-    // Try techniques in order of simplicity
+    // Serve the next step of the cached solve path; the path is
+    // only recomputed when the board has diverged from it
     // ------------------------------------------------------
+    ensureSolvePath(board);
     
-    // 1. Naked Singles (easiest)
-    if (findNakedSingle(board, hint)) {
-        return true;
-    }
-    
-    // 2. Hidden Singles
-    if (findHiddenSingle(board, hint)) {
-        return true;
-    }
-    
-    // 3. Naked Pairs
-    if (findNakedPair(board, hint)) {
-        return true;
+    size_t next = 0;
+    if (countPendingSteps(board, next) == 0) {
+        return false;
     }
     
-    // 4. Hidden Pairs
-    if (findHiddenPair(board, hint)) {
-        return true;
-    }
+    hint = m_solvePath[next];
     
-    // 5. Locked Candidates
-    if (findLockedCandidate(board, hint)) {
-        return true;
+    // Elimination steps leave no trace on the board, so remember them
+    if (!isPlacementStep(hint)) {
+        m_pathServed = next + 1;
     }
     
-    return false;
+    return true;
 }
 
 std::vector<SudokuHint> SudokuAdvancedChecks::findAllHints(const SudokuBoard& board)
@@ -80,11 +86,11 @@ std::vector<SudokuHint> SudokuAdvancedChecks::findAllHints(const SudokuBoard& bo
     // Find all naked singles
     for (int row = 0; row < SUDOKU_SIZE; ++row) {
         for (int col = 0; col < SUDOKU_SIZE; ++col) {
-            if (board.isEmpty(row, col) && m_candidates[row][col].size() == 1) {
+            if (board.isEmpty(row, col) && candidateCount(row, col) == 1) {
                 hint.type = SudokuHint::NAKED_SINGLE;
                 hint.row = row;
                 hint.col = col;
-                hint.value = *m_candidates[row][col].begin();
+                hint.value = bitboardLowestBit(m_candidates[row * SUDOKU_SIZE + col]);
                 
                 std::ostringstream oss;
                 oss << "Naked single: Cell (" << (row + 1) << "," << (col + 1) 
@@ -99,6 +105,24 @@ std::vector<SudokuHint> SudokuAdvancedChecks::findAllHints(const SudokuBoard& bo
     return hints;
 }
 
+// =================================================
+// Solve Path Cache
+// =================================================
+
+const std::vector<SudokuHint>& SudokuAdvancedChecks::getSolvePath(const SudokuBoard& board)
+{
+    ensureSolvePath(board);
+    return m_solvePath;
+}
+
+int SudokuAdvancedChecks::getRemainingSteps(const SudokuBoard& board)
+{
+    ensureSolvePath(board);
+    
+    size_t next = 0;
+    return countPendingSteps(board, next);
+}
+
 // =================================================
 // Candidate Management
 // =================================================
@@ -106,13 +130,10 @@ std::vector<SudokuHint> SudokuAdvancedChecks::findAllHints(const SudokuBoard& bo
 void SudokuAdvancedChecks::calculateCandidates(const SudokuBoard& board)
 {
     // ------------------------------------------------------
-    // Clear all candidates
+    // Clear all candidates; every link is rebuilt on next use
     // ------------------------------------------------------
-    for (int row = 0; row < SUDOKU_SIZE; ++row) {
-        for (int col = 0; col < SUDOKU_SIZE; ++col) {
-            m_candidates[row][col].clear();
-        }
-    }
+    m_candidates.fill(0);
+    markAllLinksDirty();
     
     // ------------------------------------------------------
     // Calculate candidates for each empty cell
@@ -128,10 +149,15 @@ void SudokuAdvancedChecks::calculateCandidates(const SudokuBoard& board)
 
 std::set<int> SudokuAdvancedChecks::getCandidates(int row, int col) const
 {
+    std::set<int> candidates;
     if (row >= 0 && row < SUDOKU_SIZE && col >= 0 && col < SUDOKU_SIZE) {
-        return m_candidates[row][col];
+        for (int value = 1; value <= 9; ++value) {
+            if (hasCandidate(row, col, value)) {
+                candidates.insert(value);
+            }
+        }
     }
-    return std::set<int>();
+    return candidates;
 }
 
 // =================================================
@@ -145,11 +171,11 @@ bool SudokuAdvancedChecks::findNakedSingle(const SudokuBoard& board, SudokuHint&
     // ------------------------------------------------------
     for (int row = 0; row < SUDOKU_SIZE; ++row) {
         for (int col = 0; col < SUDOKU_SIZE; ++col) {
-            if (board.isEmpty(row, col) && m_candidates[row][col].size() == 1) {
+            if (board.isEmpty(row, col) && candidateCount(row, col) == 1) {
                 hint.type = SudokuHint::NAKED_SINGLE;
                 hint.row = row;
                 hint.col = col;
-                hint.value = *m_candidates[row][col].begin();
+                hint.value = bitboardLowestBit(m_candidates[row * SUDOKU_SIZE + col]);
                 
                 std::ostringstream oss;
                 oss << "Naked single at (" << (row + 1) << "," << (col + 1) 
@@ -167,68 +193,29 @@ bool SudokuAdvancedChecks::findNakedSingle(const SudokuBoard& board, SudokuHint&
 bool SudokuAdvancedChecks::findHiddenSingle(const SudokuBoard& board, SudokuHint& hint)
 {
     // ------------------------------------------------------
-    // Check each row for hidden singles
-    // ------------------------------------------------------
-    for (int row = 0; row < SUDOKU_SIZE; ++row) {
-        if (checkRowForHiddenSingle(board, row, hint)) {
-            return true;
-        }
-    }
-    
-    // ------------------------------------------------------
-    // Check each column for hidden singles
+    // Check each unit (rows, columns, boxes, then any variant
+    // units) for hidden singles
     // ------------------------------------------------------
-    for (int col = 0; col < SUDOKU_SIZE; ++col) {
-        if (checkColForHiddenSingle(board, col, hint)) {
+    for (int unit = 0; unit < m_rules.getTables().unitCount; ++unit) {
+        if (checkUnitForHiddenSingle(board, unit, hint)) {
             return true;
         }
     }
     
-    // ------------------------------------------------------
-    // Check each 3x3 box for hidden singles
-    // ------------------------------------------------------
-    for (int boxRow = 0; boxRow < 3; ++boxRow) {
-        for (int boxCol = 0; boxCol < 3; ++boxCol) {
-            if (checkBoxForHiddenSingle(board, boxRow, boxCol, hint)) {
-                return true;
-            }
-        }
-    }
-    
     return false;
 }
 
 bool SudokuAdvancedChecks::findNakedPair(const SudokuBoard& board, SudokuHint& hint)
 {
     // ------------------------------------------------------
-    // Check rows for naked pairs
-    // ------------------------------------------------------
-    for (int row = 0; row < SUDOKU_SIZE; ++row) {
-        if (checkRowForNakedPair(row, hint)) {
-            return true;
-        }
-    }
-    
-    // ------------------------------------------------------
-    // Check columns for naked pairs
+    // Check each unit for naked pairs
     // ------------------------------------------------------
-    for (int col = 0; col < SUDOKU_SIZE; ++col) {
-        if (checkColForNakedPair(col, hint)) {
+    for (int unit = 0; unit < m_rules.getTables().unitCount; ++unit) {
+        if (checkUnitForNakedPair(unit, hint)) {
             return true;
         }
     }
     
-    // ------------------------------------------------------
-    // Check boxes for naked pairs
-    // ------------------------------------------------------
-    for (int boxRow = 0; boxRow < 3; ++boxRow) {
-        for (int boxCol = 0; boxCol < 3; ++boxCol) {
-            if (checkBoxForNakedPair(boxRow, boxCol, hint)) {
-                return true;
-            }
-        }
-    }
-    
     return false;
 }
 
@@ -246,6 +233,181 @@ bool SudokuAdvancedChecks::findLockedCandidate(const SudokuBoard& board, SudokuH
     return false;
 }
 
+bool SudokuAdvancedChecks::findCageCombination(const SudokuBoard& board, SudokuHint& hint)
+{
+    const SudokuRuleTables& tables = m_rules.getTables();
+    
+    // ------------------------------------------------------
+    // Digits a cage's empty cells could hold that no remaining
+    // sum combination uses (rules without cages have none)
+    // ------------------------------------------------------
+    for (int cage = 0; cage < tables.cageCount; ++cage) {
+        uint16_t allowed = 0;
+        std::vector<std::pair<int, int>> openCells;
+        
+        tables.cages[cage].cells.forEachCell([&](int cell) {
+            int row = SUDOKU_TABLES.cellRow[cell];
+            int col = SUDOKU_TABLES.cellCol[cell];
+            
+            if (board.isEmpty(row, col)) {
+                allowed |= m_candidates[cell];
+                openCells.push_back({row, col});
+            }
+        });
+        
+        if (openCells.empty()) {
+            continue;
+        }
+        
+        uint16_t legal = m_rules.getCageDigits(board, cage, allowed);
+        uint16_t dropped = allowed & static_cast<uint16_t>(~legal);
+        
+        hint.eliminations.clear();
+        for (const auto& cell : openCells) {
+            for (int value = 1; value <= 9; ++value) {
+                if ((dropped & (1u << value)) != 0 && hasCandidate(cell.first, cell.second, value)) {
+                    hint.eliminations.push_back({cell.first, cell.second, value});
+                }
+            }
+        }
+        
+        if (hint.eliminations.empty()) {
+            continue;
+        }
+        
+        hint.type = SudokuHint::CAGE_COMBINATION;
+        hint.row = openCells.front().first;
+        hint.col = openCells.front().second;
+        hint.value = 0;
+        hint.affectedCells = openCells;
+        
+        std::ostringstream oss;
+        oss << "Cage combination in the " << m_rules.getCageName(cage) << ": its "
+            << openCells.size() << " empty cell" << (openCells.size() == 1 ? "" : "s")
+            << " can only use {";
+        for (int value = 1, listed = 0; value <= 9; ++value) {
+            if ((legal & (1u << value)) != 0) {
+                oss << (listed++ > 0 ? "," : "") << value;
+            }
+        }
+        oss << "}";
+        hint.description = oss.str();
+        
+        return true;
+    }
+    
+    return false;
+}
+
+bool SudokuAdvancedChecks::findChain(SudokuHint& hint)
+{
+    refreshLinkGraph();
+    
+    // ------------------------------------------------------
+    // Breadth-first search from every candidate, assumed false.
+    // Strong links lead to candidates that must then be true, weak
+    // links from those to candidates that must then be false. A true
+    // end reached this way means "start or end is true", so anything
+    // seeing both ends can go. The shortest productive chain wins.
+    // ------------------------------------------------------
+    std::array<int16_t, CHAIN_NODES> parent;
+    std::array<uint8_t, CHAIN_NODES> depth;
+    std::array<uint16_t, CHAIN_NODES> queue;
+    std::bitset<CHAIN_NODES> visited;
+    
+    std::vector<SudokuElimination> eliminations;
+    std::vector<int> bestPath;
+    std::vector<SudokuElimination> bestEliminations;
+    int bestLinks = MAX_CHAIN_LINKS + 1;
+    
+    for (int start = 0; start < CHAIN_NODES; ++start) {
+        // Filled cells and eliminated candidates have no links
+        if (m_links.strongCount[start] == 0) {
+            continue;
+        }
+        
+        visited.reset();
+        visited.set(start);
+        parent[start] = -1;
+        depth[start] = 0;
+        queue[0] = static_cast<uint16_t>(start);
+        
+        int head = 0;
+        int tail = 1;
+        int found = -1;
+        
+        while (head < tail && found < 0) {
+            int node = queue[head++];
+            int nextDepth = depth[node] + 1;
+            
+            if (nextDepth >= bestLinks) {
+                break;
+            }
+            
+            auto visit = [&](int next) {
+                if (visited.test(next)) {
+                    return;
+                }
+                visited.set(next);
+                parent[next] = static_cast<int16_t>(node);
+                depth[next] = static_cast<uint8_t>(nextDepth);
+                queue[tail++] = static_cast<uint16_t>(next);
+            };
+            
+            if (depth[node] % 2 == 0) {
+                // Node is false: each strong partner must be true
+                for (int i = 0; i < m_links.strongCount[node] && found < 0; ++i) {
+                    int next = m_links.strong[node][i];
+                    if (visited.test(next)) {
+                        continue;
+                    }
+                    visit(next);
+                    
+                    if (nextDepth >= 3) {
+                        collectChainEliminations(start, next, eliminations);
+                        if (!eliminations.empty()) {
+                            found = next;
+                        }
+                    }
+                }
+            } else {
+                // Node is true: the other digits of its cell and the same
+                // digit in its peers must be false
+                int cell = node / SUDOKU_SIZE;
+                int digit = node % SUDOKU_SIZE + 1;
+                
+                for (int value = 1; value <= 9; ++value) {
+                    if (value != digit && (m_candidates[cell] & (1u << value)) != 0) {
+                        visit(cell * SUDOKU_SIZE + value - 1);
+                    }
+                }
+                m_rules.getTables().peers[cell].forEachCell([&](int peer) {
+                    if ((m_candidates[peer] & (1u << digit)) != 0) {
+                        visit(peer * SUDOKU_SIZE + digit - 1);
+                    }
+                });
+            }
+        }
+        
+        if (found >= 0) {
+            bestLinks = depth[found];
+            bestEliminations = eliminations;
+            bestPath.clear();
+            for (int node = found; node >= 0; node = parent[node]) {
+                bestPath.insert(bestPath.begin(), node);
+            }
+        }
+    }
+    
+    if (bestPath.empty()) {
+        return false;
+    }
+    
+    hint.eliminations = bestEliminations;
+    describeChain(bestPath, hint);
+    return true;
+}
+
 // =================================================
 // Analysis Methods
 // =================================================
@@ -264,7 +426,7 @@ int SudokuAdvancedChecks::estimateDifficulty(const SudokuBoard& board)
     for (int row = 0; row < SUDOKU_SIZE; ++row) {
         for (int col = 0; col < SUDOKU_SIZE; ++col) {
             if (board.isEmpty(row, col)) {
-                int count = m_candidates[row][col].size();
+                int count = candidateCount(row, col);
                 if (count == 1) singleCandidates++;
                 else if (count == 2) twoCandidates++;
                 else if (count > 2) manyCandidates++;
@@ -291,40 +453,87 @@ bool SudokuAdvancedChecks::canSolveWithBasicTechniques(const SudokuBoard& board)
 void SudokuAdvancedChecks::updateCandidatesForCell(const SudokuBoard& board, int row, int col)
 {
     // ------------------------------------------------------
-    // Try each value 1-9 and see if it's valid
+    // Digits absent from every unit of the cell
     // ------------------------------------------------------
-    for (int value = 1; value <= 9; ++value) {
-        if (board.isValidPlacement(row, col, value)) {
-            m_candidates[row][col].insert(value);
-        }
+    m_candidates[row * SUDOKU_SIZE + col] = m_rules.getCandidateMask(board, row, col);
+}
+
+void SudokuAdvancedChecks::removeCandidate(int cell, int value)
+{
+    uint16_t bit = static_cast<uint16_t>(1u << value);
+    if ((m_candidates[cell] & bit) == 0) {
+        return;
+    }
+    
+    // ------------------------------------------------------
+    // Conjugate links of this digit in the cell's units and the
+    // cell's own bivalue link may have changed
+    // ------------------------------------------------------
+    m_candidates[cell] &= static_cast<uint16_t>(~bit);
+    
+    for (uint64_t units = m_rules.getTables().cellUnits[cell]; units != 0; units &= units - 1) {
+        m_links.dirtyDigits[bitboardLowestBit(units)] |= bit;
     }
+    m_links.dirtyCells.set(cell);
+}
+
+void SudokuAdvancedChecks::markAllLinksDirty()
+{
+    m_links.dirtyDigits.fill(0x3FE);
+    m_links.dirtyCells.set();
 }
 
-bool SudokuAdvancedChecks::checkRowForHiddenSingle(const SudokuBoard& board, int row, SudokuHint& hint)
+int SudokuAdvancedChecks::candidateCount(int row, int col) const
 {
+    return bitboardPopCount(m_candidates[row * SUDOKU_SIZE + col]);
+}
+
+bool SudokuAdvancedChecks::hasCandidate(int row, int col, int value) const
+{
+    return (m_candidates[row * SUDOKU_SIZE + col] & (1u << value)) != 0;
+}
+
+bool SudokuAdvancedChecks::checkUnitForHiddenSingle(const SudokuBoard& board, int unit, SudokuHint& hint)
+{
+    const SudokuRuleTables& tables = m_rules.getTables();
+    
     // ------------------------------------------------------
-    // For each value, count how many cells in row can have it
+    // For each value, count how many cells in the unit can have it
     // ------------------------------------------------------
     for (int value = 1; value <= 9; ++value) {
         int count = 0;
-        int lastCol = -1;
+        int lastRow = -1, lastCol = -1;
         
-        for (int col = 0; col < SUDOKU_SIZE; ++col) {
-            if (board.isEmpty(row, col) && m_candidates[row][col].count(value) > 0) {
+        for (uint8_t cell : tables.unitCells[unit]) {
+            int r = SUDOKU_TABLES.cellRow[cell];
+            int c = SUDOKU_TABLES.cellCol[cell];
+            
+            if (board.isEmpty(r, c) && hasCandidate(r, c, value)) {
                 count++;
-                lastCol = col;
+                lastRow = r;
+                lastCol = c;
             }
         }
         
         if (count == 1) {
             hint.type = SudokuHint::HIDDEN_SINGLE;
-            hint.row = row;
+            hint.row = lastRow;
             hint.col = lastCol;
             hint.value = value;
             
             std::ostringstream oss;
-            oss << "Hidden single in row " << (row + 1) << ": " 
-                << value << " can only go in column " << (lastCol + 1);
+            oss << "Hidden single in " << m_rules.getUnitName(unit) << ": " << value;
+            switch (tables.unitKinds[unit]) {
+                case SudokuUnitKind::ROW:
+                    oss << " can only go in column " << (lastCol + 1);
+                    break;
+                case SudokuUnitKind::COLUMN:
+                    oss << " can only go in row " << (lastRow + 1);
+                    break;
+                default:
+                    oss << " can only go at (" << (lastRow + 1) << "," << (lastCol + 1) << ")";
+                    break;
+            }
             hint.description = oss.str();
             
             return true;
@@ -334,31 +543,49 @@ bool SudokuAdvancedChecks::checkRowForHiddenSingle(const SudokuBoard& board, int
     return false;
 }
 
-bool SudokuAdvancedChecks::checkColForHiddenSingle(const SudokuBoard& board, int col, SudokuHint& hint)
+bool SudokuAdvancedChecks::checkUnitForNakedPair(int unit, SudokuHint& hint)
 {
+    const auto& unitCells = m_rules.getTables().unitCells[unit];
+    
     // ------------------------------------------------------
-    // For each value, count how many cells in column can have it
+    // Find two cells with exactly the same two candidates
+    // that still eliminate something from the rest of the unit
     // ------------------------------------------------------
-    for (int value = 1; value <= 9; ++value) {
-        int count = 0;
-        int lastRow = -1;
-        
-        for (int row = 0; row < SUDOKU_SIZE; ++row) {
-            if (board.isEmpty(row, col) && m_candidates[row][col].count(value) > 0) {
-                count++;
-                lastRow = row;
-            }
+    for (int i = 0; i < SUDOKU_UNIT_SIZE; ++i) {
+        int cell1 = unitCells[i];
+        if (bitboardPopCount(m_candidates[cell1]) != 2) {
+            continue;
         }
         
-        if (count == 1) {
-            hint.type = SudokuHint::HIDDEN_SINGLE;
-            hint.row = lastRow;
-            hint.col = col;
-            hint.value = value;
+        for (int j = i + 1; j < SUDOKU_UNIT_SIZE; ++j) {
+            int cell2 = unitCells[j];
+            if (m_candidates[cell2] != m_candidates[cell1]) {
+                continue;
+            }
+            
+            collectPairEliminations(unit, cell1, cell2, hint);
+            if (hint.eliminations.empty()) {
+                continue;
+            }
+            
+            int r1 = SUDOKU_TABLES.cellRow[cell1], c1 = SUDOKU_TABLES.cellCol[cell1];
+            int r2 = SUDOKU_TABLES.cellRow[cell2], c2 = SUDOKU_TABLES.cellCol[cell2];
+            
+            hint.type = SudokuHint::NAKED_PAIR;
+            hint.row = r1;
+            hint.col = c1;
+            hint.value = 0;
+            hint.affectedCells = {{r1, c1}, {r2, c2}};
+            
+            uint16_t pair = m_candidates[cell1];
+            int val1 = bitboardLowestBit(pair);
+            int val2 = bitboardLowestBit(pair & (pair - 1));
             
             std::ostringstream oss;
-            oss << "Hidden single in column " << (col + 1) << ": " 
-                << value << " can only go in row " << (lastRow + 1);
+            oss << "Naked pair in " << m_rules.getUnitName(unit) << ": Cells ("
+                << (r1 + 1) << "," << (c1 + 1) << ") and ("
+                << (r2 + 1) << "," << (c2 + 1) << ") both contain {"
+                << val1 << "," << val2 << "}";
             hint.description = oss.str();
             
             return true;
@@ -368,156 +595,351 @@ bool SudokuAdvancedChecks::checkColForHiddenSingle(const SudokuBoard& board, int
     return false;
 }
 
-bool SudokuAdvancedChecks::checkBoxForHiddenSingle(const SudokuBoard& board, int boxRow, int boxCol, SudokuHint& hint)
+void SudokuAdvancedChecks::collectPairEliminations(int unit, int cell1, int cell2, SudokuHint& hint) const
 {
-    int startRow = boxRow * 3;
-    int startCol = boxCol * 3;
+    // ------------------------------------------------------
+    // Pair values can be removed from every other cell of the unit
+    // ------------------------------------------------------
+    hint.eliminations.clear();
+    
+    uint16_t pair = m_candidates[cell1];
     
+    for (uint8_t cell : m_rules.getTables().unitCells[unit]) {
+        if (cell == cell1 || cell == cell2) {
+            continue;
+        }
+        
+        for (int value = 1; value <= 9; ++value) {
+            if ((pair & (1u << value)) != 0 && (m_candidates[cell] & (1u << value)) != 0) {
+                hint.eliminations.push_back({SUDOKU_TABLES.cellRow[cell], SUDOKU_TABLES.cellCol[cell], value});
+            }
+        }
+    }
+}
+
+// =================================================
+// Chain Link Graph
+// =================================================
+
+void SudokuAdvancedChecks::refreshLinkGraph()
+{
     // ------------------------------------------------------
-    // For each value, count how many cells in box can have it
+    // Recompute only the nodes whose links can have changed: the
+    // dirty digits of each touched unit and every node of a cell
+    // whose mask changed
     // ------------------------------------------------------
-    for (int value = 1; value <= 9; ++value) {
-        int count = 0;
-        int lastRow = -1, lastCol = -1;
+    const SudokuRuleTables& tables = m_rules.getTables();
+    
+    for (int unit = 0; unit < tables.unitCount; ++unit) {
+        uint16_t digits = m_links.dirtyDigits[unit];
+        if (digits == 0) {
+            continue;
+        }
         
-        for (int r = startRow; r < startRow + 3; ++r) {
-            for (int c = startCol; c < startCol + 3; ++c) {
-                if (board.isEmpty(r, c) && m_candidates[r][c].count(value) > 0) {
-                    count++;
-                    lastRow = r;
-                    lastCol = c;
+        for (uint8_t cell : tables.unitCells[unit]) {
+            for (int digit = 1; digit <= 9; ++digit) {
+                if ((digits & (1u << digit)) != 0) {
+                    rebuildNodeLinks(cell, digit);
                 }
             }
         }
+        m_links.dirtyDigits[unit] = 0;
+    }
+    
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        if (m_links.dirtyCells.test(cell)) {
+            for (int digit = 1; digit <= 9; ++digit) {
+                rebuildNodeLinks(cell, digit);
+            }
+        }
+    }
+    m_links.dirtyCells.reset();
+}
+
+void SudokuAdvancedChecks::rebuildNodeLinks(int cell, int digit)
+{
+    int node = cell * SUDOKU_SIZE + digit - 1;
+    uint16_t bit = static_cast<uint16_t>(1u << digit);
+    uint8_t count = 0;
+    
+    if ((m_candidates[cell] & bit) != 0) {
+        // ------------------------------------------------------
+        // Conjugate pairs: the digit has one other place in a unit
+        // (one slot is kept for the bivalue link)
+        // ------------------------------------------------------
+        const SudokuRuleTables& tables = m_rules.getTables();
         
-        if (count == 1) {
-            hint.type = SudokuHint::HIDDEN_SINGLE;
-            hint.row = lastRow;
-            hint.col = lastCol;
-            hint.value = value;
+        for (uint64_t units = tables.cellUnits[cell]; units != 0 && count < MAX_STRONG_LINKS - 1; units &= units - 1) {
+            int other = -1;
+            int places = 0;
             
-            std::ostringstream oss;
-            oss << "Hidden single in box (" << (boxRow + 1) << "," << (boxCol + 1) 
-                << "): " << value << " can only go at (" << (lastRow + 1) << "," << (lastCol + 1) << ")";
-            hint.description = oss.str();
+            for (uint8_t peer : tables.unitCells[bitboardLowestBit(units)]) {
+                if ((m_candidates[peer] & bit) != 0) {
+                    ++places;
+                    if (peer != cell) {
+                        other = peer;
+                    }
+                }
+            }
             
-            return true;
+            if (places != 2) {
+                continue;
+            }
+            
+            uint16_t link = static_cast<uint16_t>(other * SUDOKU_SIZE + digit - 1);
+            bool known = false;
+            for (uint8_t i = 0; i < count; ++i) {
+                known = known || m_links.strong[node][i] == link;
+            }
+            if (!known) {
+                m_links.strong[node][count++] = link;
+            }
+        }
+        
+        // ------------------------------------------------------
+        // Bivalue cell: the other digit of the cell
+        // ------------------------------------------------------
+        if (bitboardPopCount(m_candidates[cell]) == 2) {
+            int other = bitboardLowestBit(m_candidates[cell] & static_cast<uint16_t>(~bit));
+            m_links.strong[node][count++] = static_cast<uint16_t>(cell * SUDOKU_SIZE + other - 1);
         }
     }
     
-    return false;
+    m_links.strongCount[node] = count;
 }
 
-bool SudokuAdvancedChecks::checkRowForNakedPair(int row, SudokuHint& hint)
+void SudokuAdvancedChecks::collectChainEliminations(int startNode, int endNode,
+                                                    std::vector<SudokuElimination>& eliminations) const
 {
     // ------------------------------------------------------
-    // Find two cells with exactly the same two candidates
+    // A candidate weakly linked to both ends would make both false
     // ------------------------------------------------------
-    for (int col1 = 0; col1 < SUDOKU_SIZE; ++col1) {
-        if (m_candidates[row][col1].size() == 2) {
-            for (int col2 = col1 + 1; col2 < SUDOKU_SIZE; ++col2) {
-                if (m_candidates[row][col2] == m_candidates[row][col1]) {
-                    hint.type = SudokuHint::NAKED_PAIR;
-                    hint.row = row;
-                    hint.col = col1;
-                    
-                    auto it = m_candidates[row][col1].begin();
-                    int val1 = *it++;
-                    int val2 = *it;
-                    
-                    std::ostringstream oss;
-                    oss << "Naked pair in row " << (row + 1) << ": Cells (" 
-                        << (row + 1) << "," << (col1 + 1) << ") and (" 
-                        << (row + 1) << "," << (col2 + 1) << ") both contain {" 
-                        << val1 << "," << val2 << "}";
-                    hint.description = oss.str();
-                    
-                    return true;
-                }
+    eliminations.clear();
+    
+    int startCell = startNode / SUDOKU_SIZE;
+    int endCell = endNode / SUDOKU_SIZE;
+    int startDigit = startNode % SUDOKU_SIZE + 1;
+    int endDigit = endNode % SUDOKU_SIZE + 1;
+    
+    auto eliminate = [&](int cell, int value) {
+        if ((m_candidates[cell] & (1u << value)) != 0) {
+            eliminations.push_back({SUDOKU_TABLES.cellRow[cell], SUDOKU_TABLES.cellCol[cell], value});
+        }
+    };
+    
+    const auto& peers = m_rules.getTables().peers;
+    
+    if (startDigit == endDigit) {
+        // The digit in every cell that sees both ends
+        (peers[startCell] & peers[endCell]).forEachCell([&](int peer) {
+            eliminate(peer, startDigit);
+        });
+    } else if (startCell == endCell) {
+        // One of two digits holds the cell: all others go
+        for (int value = 1; value <= 9; ++value) {
+            if (value != startDigit && value != endDigit) {
+                eliminate(startCell, value);
             }
         }
+    } else if (peers[startCell].test(endCell)) {
+        // Ends see each other: each cell loses the other end's digit
+        eliminate(startCell, endDigit);
+        eliminate(endCell, startDigit);
     }
-    
-    return false;
 }
 
-bool SudokuAdvancedChecks::checkColForNakedPair(int col, SudokuHint& hint)
+void SudokuAdvancedChecks::describeChain(const std::vector<int>& path, SudokuHint& hint) const
 {
     // ------------------------------------------------------
-    // Find two cells with exactly the same two candidates
+    // Classify: one digit throughout is an X-chain, strong links
+    // only inside bivalue cells is an XY-chain, anything else an AIC
     // ------------------------------------------------------
-    for (int row1 = 0; row1 < SUDOKU_SIZE; ++row1) {
-        if (m_candidates[row1][col].size() == 2) {
-            for (int row2 = row1 + 1; row2 < SUDOKU_SIZE; ++row2) {
-                if (m_candidates[row2][col] == m_candidates[row1][col]) {
-                    hint.type = SudokuHint::NAKED_PAIR;
-                    hint.row = row1;
-                    hint.col = col;
-                    
-                    auto it = m_candidates[row1][col].begin();
-                    int val1 = *it++;
-                    int val2 = *it;
-                    
-                    std::ostringstream oss;
-                    oss << "Naked pair in column " << (col + 1) << ": Cells (" 
-                        << (row1 + 1) << "," << (col + 1) << ") and (" 
-                        << (row2 + 1) << "," << (col + 1) << ") both contain {" 
-                        << val1 << "," << val2 << "}";
-                    hint.description = oss.str();
-                    
-                    return true;
-                }
-            }
+    bool singleDigit = true;
+    bool bivalueOnly = true;
+    
+    for (size_t i = 1; i < path.size(); ++i) {
+        int fromCell = path[i - 1] / SUDOKU_SIZE;
+        int toCell = path[i] / SUDOKU_SIZE;
+        
+        singleDigit = singleDigit && path[i] % SUDOKU_SIZE == path[0] % SUDOKU_SIZE;
+        if (i % 2 == 1) {
+            bivalueOnly = bivalueOnly && fromCell == toCell;
+        } else {
+            bivalueOnly = bivalueOnly && fromCell != toCell;
         }
     }
     
-    return false;
+    std::ostringstream oss;
+    if (singleDigit) {
+        hint.type = SudokuHint::X_CHAIN;
+        oss << "X-chain on " << (path[0] % SUDOKU_SIZE + 1) << ": ";
+    } else if (bivalueOnly) {
+        hint.type = SudokuHint::XY_CHAIN;
+        oss << "XY-chain: ";
+    } else {
+        hint.type = SudokuHint::ALTERNATING_CHAIN;
+        oss << "Alternating inference chain: ";
+    }
+    
+    // ------------------------------------------------------
+    // Notation: r1c1(5) = r1c4(5) - r4c4(5) = ..., where "=" is a
+    // strong link and "-" a weak link; path cells in order
+    // ------------------------------------------------------
+    hint.affectedCells.clear();
+    
+    for (size_t i = 0; i < path.size(); ++i) {
+        int cell = path[i] / SUDOKU_SIZE;
+        int row = SUDOKU_TABLES.cellRow[cell];
+        int col = SUDOKU_TABLES.cellCol[cell];
+        
+        if (i > 0) {
+            oss << (i % 2 == 1 ? " = " : " - ");
+        }
+        oss << "r" << (row + 1) << "c" << (col + 1) << "(" << (path[i] % SUDOKU_SIZE + 1) << ")";
+        
+        if (hint.affectedCells.empty() || hint.affectedCells.back() != std::make_pair(row, col)) {
+            hint.affectedCells.push_back({row, col});
+        }
+    }
+    oss << ". One end must be true, so candidates seeing both ends are removed";
+    
+    hint.row = hint.affectedCells.front().first;
+    hint.col = hint.affectedCells.front().second;
+    hint.value = 0;
+    hint.description = oss.str();
 }
 
-bool SudokuAdvancedChecks::checkBoxForNakedPair(int boxRow, int boxCol, SudokuHint& hint)
+// =================================================
+// Solve Path Methods
+// =================================================
+
+void SudokuAdvancedChecks::ensureSolvePath(const SudokuBoard& board)
+{
+    if (!m_pathValid || !isPathConsistent(board)) {
+        computeSolvePath(board);
+    }
+}
+
+void SudokuAdvancedChecks::computeSolvePath(const SudokuBoard& board)
 {
-    int startRow = boxRow * 3;
-    int startCol = boxCol * 3;
-    
     // ------------------------------------------------------
-    // Collect all cells in box with exactly 2 candidates
+    // Apply techniques to a working copy until none applies,
+    // recording every step in order
     // ------------------------------------------------------
-    std::vector<std::pair<int, int>> pairCells;
+    SudokuBoard work;
+    work.copyBoard(board);
     
-    for (int r = startRow; r < startRow + 3; ++r) {
-        for (int c = startCol; c < startCol + 3; ++c) {
-            if (m_candidates[r][c].size() == 2) {
-                pairCells.push_back({r, c});
-            }
-        }
+    m_solvePath.clear();
+    m_pathServed = 0;
+    m_pathStart = board.getBoard();
+    
+    calculateCandidates(work);
+    
+    SudokuHint step;
+    while (findLogicalStep(work, step)) {
+        applyStep(work, step);
+        m_solvePath.push_back(step);
     }
     
-    // Check for matching pairs
-    for (size_t i = 0; i < pairCells.size(); ++i) {
-        for (size_t j = i + 1; j < pairCells.size(); ++j) {
-            int r1 = pairCells[i].first, c1 = pairCells[i].second;
-            int r2 = pairCells[j].first, c2 = pairCells[j].second;
+    m_pathTarget = work.getBoard();
+    m_pathValid = true;
+    
+    // Leave candidates describing the caller's board, not the working copy
+    calculateCandidates(board);
+}
+
+bool SudokuAdvancedChecks::isPathConsistent(const SudokuBoard& board) const
+{
+    // ------------------------------------------------------
+    // Every cell must hold its start value or the value the path places
+    // ------------------------------------------------------
+    for (int row = 0; row < SUDOKU_SIZE; ++row) {
+        for (int col = 0; col < SUDOKU_SIZE; ++col) {
+            int value = board.getValue(row, col);
+            int start = m_pathStart[row][col];
             
-            if (m_candidates[r1][c1] == m_candidates[r2][c2]) {
-                hint.type = SudokuHint::NAKED_PAIR;
-                hint.row = r1;
-                hint.col = c1;
-                
-                auto it = m_candidates[r1][c1].begin();
-                int val1 = *it++;
-                int val2 = *it;
-                
-                std::ostringstream oss;
-                oss << "Naked pair in box (" << (boxRow + 1) << "," << (boxCol + 1) 
-                    << "): Cells (" << (r1 + 1) << "," << (c1 + 1) << ") and (" 
-                    << (r2 + 1) << "," << (c2 + 1) << ") both contain {" 
-                    << val1 << "," << val2 << "}";
-                hint.description = oss.str();
-                
-                return true;
+            if (value == start) {
+                continue;
+            }
+            
+            if (start != 0 || value != m_pathTarget[row][col]) {
+                return false;
             }
         }
     }
+    return true;
+}
+
+int SudokuAdvancedChecks::countPendingSteps(const SudokuBoard& board, size_t& firstPending) const
+{
+    // ------------------------------------------------------
+    // Placements are pending while their cell is empty; eliminations
+    // are pending until shown, and only while a later placement is
+    // ------------------------------------------------------
+    int pending = 0;
+    bool placementPending = false;
+    firstPending = m_solvePath.size();
     
-    return false;
+    for (size_t i = m_solvePath.size(); i-- > 0;) {
+        const SudokuHint& step = m_solvePath[i];
+        bool stepPending;
+        
+        if (isPlacementStep(step)) {
+            stepPending = board.isEmpty(step.row, step.col);
+            placementPending = placementPending || stepPending;
+        } else {
+            stepPending = i >= m_pathServed && placementPending;
+        }
+        
+        if (stepPending) {
+            ++pending;
+            firstPending = i;
+        }
+    }
+    
+    return pending;
+}
+
+bool SudokuAdvancedChecks::findLogicalStep(const SudokuBoard& board, SudokuHint& hint)
+{
+    hint = SudokuHint{};
+    
+    // ------------------------------------------------------
+    // Try techniques in order of simplicity
+    // ------------------------------------------------------
+    return findNakedSingle(board, hint) ||
+           findHiddenSingle(board, hint) ||
+           findCageCombination(board, hint) ||
+           findNakedPair(board, hint) ||
+           findHiddenPair(board, hint) ||
+           findLockedCandidate(board, hint) ||
+           findChain(hint);
+}
+
+void SudokuAdvancedChecks::applyStep(SudokuBoard& board, const SudokuHint& step)
+{
+    if (isPlacementStep(step)) {
+        int cell = step.row * SUDOKU_SIZE + step.col;
+        board.setValue(step.row, step.col, step.value);
+        for (int value = 1; value <= 9; ++value) {
+            removeCandidate(cell, value);
+        }
+        eliminateFromPeers(step.row, step.col, step.value);
+    }
+    
+    for (const SudokuElimination& elimination : step.eliminations) {
+        removeCandidate(elimination.row * SUDOKU_SIZE + elimination.col, elimination.value);
+    }
+}
+
+void SudokuAdvancedChecks::eliminateFromPeers(int row, int col, int value)
+{
+    m_rules.getTables().peers[row * SUDOKU_SIZE + col].forEachCell([this, value](int peer) {
+        removeCandidate(peer, value);
+    });
+}
+
+bool SudokuAdvancedChecks::isPlacementStep(const SudokuHint& step)
+{
+    return step.type == SudokuHint::NAKED_SINGLE || step.type == SudokuHint::HIDDEN_SINGLE;
 }
@@ -3,8 +3,12 @@
  * @brief Advanced Sudoku solving techniques and analysis
  *
  * This header defines advanced solving techniques beyond basic backtracking,
- * including naked pairs, hidden pairs, locked candidates, and pointing pairs.
- * These techniques can be used for hints and puzzle analysis.
+ * including naked pairs, hidden pairs, locked candidates, and pointing pairs,
+ * and chaining techniques (X-chains, XY-chains and alternating inference
+ * chains) searched over a strong-link graph that is kept in step with the
+ * candidate masks. These techniques can be used for hints and puzzle analysis.
+ * Units and peers come from a rule set, so the same techniques give hints
+ * for variants (diagonals, windows, irregular regions, Killer cages).
  *
  * @author Salah-Eldin Hassen
  * @date December 2025
@@ -15,6 +19,10 @@
 #pragma once
 
 #include "SudokuBoard.hpp"
+#include "SudokuRuleSet.hpp"
+#include <array>
+#include <bitset>
+#include <cstdint>
 #include <vector>
 #include <set>
 #include <string>
@@ -23,6 +31,13 @@
 // Hint Structure
 // =================================================
 
+struct SudokuElimination
+{
+    int row;
+    int col;
+    int value;
+};
+
 struct SudokuHint
 {
     enum Type {
@@ -31,6 +46,10 @@ struct SudokuHint
         NAKED_PAIR,        // Two cells with same two candidates
         HIDDEN_PAIR,       // Two values locked to two cells
         LOCKED_CANDIDATE,  // Pointing/Claiming technique
+        CAGE_COMBINATION,  // Digits no Killer cage sum combination uses
+        X_CHAIN,           // Alternating chain on a single digit
+        XY_CHAIN,          // Chain through bivalue cells
+        ALTERNATING_CHAIN, // General alternating inference chain (AIC)
         BASIC_ELIMINATION  // Simple elimination
     };
     
@@ -39,7 +58,8 @@ struct SudokuHint
     int col;
     int value;
     std::string description;
-    std::vector<std::pair<int, int>> affectedCells;
+    std::vector<std::pair<int, int>> affectedCells;  // Chain steps: cells of the path in order
+    std::vector<SudokuElimination> eliminations;   // Candidates removed by this step
 };
 
 // =================================================
@@ -61,11 +81,25 @@ public:
     bool findHint(const SudokuBoard& board, SudokuHint& hint);
     std::vector<SudokuHint> findAllHints(const SudokuBoard& board);
     
+    // ------------------------------------------------------
+    // Solve Path Cache
+    // ------------------------------------------------------
+    const std::vector<SudokuHint>& getSolvePath(const SudokuBoard& board);
+    int getRemainingSteps(const SudokuBoard& board);
+    void invalidateSolvePath() { m_pathValid = false; }
+    
+    // ------------------------------------------------------
+    // Variant Rules (classic by default)
+    // ------------------------------------------------------
+    void setRuleSet(const SudokuRuleSet& rules);
+    const SudokuRuleSet& getRuleSet() const { return m_rules; }
+    
     // ------------------------------------------------------
     // Candidate Management
     // ------------------------------------------------------
     void calculateCandidates(const SudokuBoard& board);
     std::set<int> getCandidates(int row, int col) const;
+    uint16_t getCandidateMask(int row, int col) const { return m_candidates[row * 9 + col]; }   // Bit v = digit v
     
     // ------------------------------------------------------
     // Analysis Methods
@@ -74,10 +108,47 @@ public:
     bool canSolveWithBasicTechniques(const SudokuBoard& board);
 
 private:
+    // ------------------------------------------------------
+    // Chain link graph: one node per candidate (cell * 9 + digit - 1).
+    // Strong links are stored; weak links are implied by the masks
+    // (same cell, or same digit in peer cells)
+    // ------------------------------------------------------
+    static constexpr int CHAIN_NODES = SUDOKU_CELLS * SUDOKU_SIZE;
+    static constexpr int MAX_STRONG_LINKS = 8;   // Conjugates in up to seven units + bivalue cell
+    static constexpr int MAX_CHAIN_LINKS = 13;   // Longest chain the search reports
+    
+    struct LinkGraph
+    {
+        std::array<std::array<uint16_t, MAX_STRONG_LINKS>, CHAIN_NODES> strong;
+        std::array<uint8_t, CHAIN_NODES> strongCount;
+        std::array<uint16_t, MAX_RULE_UNITS> dirtyDigits; // Per unit: digits with stale links
+        std::bitset<SUDOKU_CELLS> dirtyCells;              // Cells whose mask changed
+    };
+    
     // ------------------------------------------------------
     // Private Data Members
     // ------------------------------------------------------
-    std::array<std::array<std::set<int>, SUDOKU_SIZE>, SUDOKU_SIZE> m_candidates;
+    std::array<uint16_t, SUDOKU_CELLS> m_candidates;   // Bit v set = digit v possible
+    SudokuRuleSet m_rules;                             // Units the candidates and hints follow
+    LinkGraph m_links;
+    
+    std::vector<SudokuHint> m_solvePath;   // Ordered logical steps from m_pathStart
+    SudokuGrid m_pathStart;                // Board state the path was computed from
+    SudokuGrid m_pathTarget;               // Start state plus every value the path places
+    size_t m_pathServed;                   // Elimination steps before this index were shown
+    bool m_pathValid;
+    
+    // ------------------------------------------------------
+    // Solve Path Methods
+    // ------------------------------------------------------
+    void ensureSolvePath(const SudokuBoard& board);
+    void computeSolvePath(const SudokuBoard& board);
+    bool isPathConsistent(const SudokuBoard& board) const;
+    int countPendingSteps(const SudokuBoard& board, size_t& firstPending) const;
+    bool findLogicalStep(const SudokuBoard& board, SudokuHint& hint);
+    void applyStep(SudokuBoard& board, const SudokuHint& step);
+    void eliminateFromPeers(int row, int col, int value);
+    static bool isPlacementStep(const SudokuHint& step);
     
     // ------------------------------------------------------
     // Technique Detection Methods
@@ -87,16 +158,23 @@ private:
     bool findNakedPair(const SudokuBoard& board, SudokuHint& hint);
     bool findHiddenPair(const SudokuBoard& board, SudokuHint& hint);
     bool findLockedCandidate(const SudokuBoard& board, SudokuHint& hint);
+    bool findCageCombination(const SudokuBoard& board, SudokuHint& hint);
+    bool findChain(SudokuHint& hint);
     
     // ------------------------------------------------------
     // Helper Methods
     // ------------------------------------------------------
     void updateCandidatesForCell(const SudokuBoard& board, int row, int col);
-    bool checkRowForHiddenSingle(const SudokuBoard& board, int row, SudokuHint& hint);
-    bool checkColForHiddenSingle(const SudokuBoard& board, int col, SudokuHint& hint);
-    bool checkBoxForHiddenSingle(const SudokuBoard& board, int boxRow, int boxCol, SudokuHint& hint);
+    void removeCandidate(int cell, int value);
+    void markAllLinksDirty();
+    int candidateCount(int row, int col) const;
+    bool hasCandidate(int row, int col, int value) const;
+    bool checkUnitForHiddenSingle(const SudokuBoard& board, int unit, SudokuHint& hint);
+    bool checkUnitForNakedPair(int unit, SudokuHint& hint);
+    void collectPairEliminations(int unit, int cell1, int cell2, SudokuHint& hint) const;
     
-    bool checkRowForNakedPair(int row, SudokuHint& hint);
-    bool checkColForNakedPair(int col, SudokuHint& hint);
-    bool checkBoxForNakedPair(int boxRow, int boxCol, SudokuHint& hint);
+    void refreshLinkGraph();
+    void rebuildNodeLinks(int cell, int digit);
+    void collectChainEliminations(int startNode, int endNode, std::vector<SudokuElimination>& eliminations) const;
+    void describeChain(const std::vector<int>& path, SudokuHint& hint) const;
 };
@@ -0,0 +1,585 @@
+/**
+ * @file SudokuBatchSolver.cpp
+ * @brief Implementation of lane-parallel batch solving
+ *
+ * This file implements the lane scheduler with its per-lane search stacks,
+ * and the propagation round shared by all lanes, written on explicit
+ * SSE2/AVX2 lane vectors over band words.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#include "SudokuBatchSolver.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// =================================================
+// Lane Vectors
+// =================================================
+
+// ------------------------------------------------------
+// One register holds the same band word of several lanes: eight
+// with AVX2, four with SSE2, one otherwise. Tests return all-ones
+// for true and zero for false in each lane, so per-lane decisions
+// are masks, never branches.
+// ------------------------------------------------------
+
+#if defined(__AVX2__)
+
+using LaneVector = __m256i;
+
+static inline LaneVector laneLoad(const uint32_t* words)
+{
+    return _mm256_load_si256(reinterpret_cast<const __m256i*>(words));
+}
+
+static inline void laneStore(uint32_t* words, LaneVector v)
+{
+    _mm256_store_si256(reinterpret_cast<__m256i*>(words), v);
+}
+
+static inline LaneVector laneBroadcast(uint32_t word) { return _mm256_set1_epi32(static_cast<int>(word)); }
+static inline LaneVector laneAnd(LaneVector a, LaneVector b) { return _mm256_and_si256(a, b); }
+static inline LaneVector laneOr(LaneVector a, LaneVector b) { return _mm256_or_si256(a, b); }
+static inline LaneVector laneAndNot(LaneVector a, LaneVector b) { return _mm256_andnot_si256(b, a); }
+static inline LaneVector laneIsZero(LaneVector a) { return _mm256_cmpeq_epi32(a, _mm256_setzero_si256()); }
+template <int N> static inline LaneVector laneShiftLeft(LaneVector a) { return _mm256_slli_epi32(a, N); }
+template <int N> static inline LaneVector laneShiftRight(LaneVector a) { return _mm256_srli_epi32(a, N); }
+
+#elif SUDOKU_BITBOARD_SSE2
+
+using LaneVector = __m128i;
+
+static inline LaneVector laneLoad(const uint32_t* words)
+{
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(words));
+}
+
+static inline void laneStore(uint32_t* words, LaneVector v)
+{
+    _mm_store_si128(reinterpret_cast<__m128i*>(words), v);
+}
+
+static inline LaneVector laneBroadcast(uint32_t word) { return _mm_set1_epi32(static_cast<int>(word)); }
+static inline LaneVector laneAnd(LaneVector a, LaneVector b) { return _mm_and_si128(a, b); }
+static inline LaneVector laneOr(LaneVector a, LaneVector b) { return _mm_or_si128(a, b); }
+static inline LaneVector laneAndNot(LaneVector a, LaneVector b) { return _mm_andnot_si128(b, a); }
+static inline LaneVector laneIsZero(LaneVector a) { return _mm_cmpeq_epi32(a, _mm_setzero_si128()); }
+template <int N> static inline LaneVector laneShiftLeft(LaneVector a) { return _mm_slli_epi32(a, N); }
+template <int N> static inline LaneVector laneShiftRight(LaneVector a) { return _mm_srli_epi32(a, N); }
+
+#else
+
+using LaneVector = uint32_t;
+
+static inline LaneVector laneLoad(const uint32_t* words) { return *words; }
+static inline void laneStore(uint32_t* words, LaneVector v) { *words = v; }
+static inline LaneVector laneBroadcast(uint32_t word) { return word; }
+static inline LaneVector laneAnd(LaneVector a, LaneVector b) { return a & b; }
+static inline LaneVector laneOr(LaneVector a, LaneVector b) { return a | b; }
+static inline LaneVector laneAndNot(LaneVector a, LaneVector b) { return a & ~b; }
+static inline LaneVector laneIsZero(LaneVector a) { return uint32_t(0) - static_cast<uint32_t>(a == 0); }
+template <int N> static inline LaneVector laneShiftLeft(LaneVector a) { return a << N; }
+template <int N> static inline LaneVector laneShiftRight(LaneVector a) { return a >> N; }
+
+#endif
+
+static constexpr int LANE_VECTOR_WIDTH = static_cast<int>(sizeof(LaneVector) / sizeof(uint32_t));
+
+static_assert(SudokuBatchSolver::LANES % LANE_VECTOR_WIDTH == 0, "Lanes must fill whole vectors");
+
+static inline LaneVector laneNot(LaneVector a) { return laneAndNot(laneBroadcast(~uint32_t(0)), a); }
+
+// =================================================
+// Band Words
+// =================================================
+
+// ------------------------------------------------------
+// A band word holds three rows of nine cells, bit 9 * row + col.
+// A segment is the three cells of a row inside one box; segment
+// results sit on the segment's first bit. Column results sit on
+// bits 0-8, one per column.
+// ------------------------------------------------------
+static constexpr uint32_t BAND_CELLS = 0x7FFFFFF;
+static constexpr uint32_t SEGMENT_BASES = 0x1249249;        // Bits 0, 3, ..., 24
+static constexpr uint32_t FIRST_ROW_SEGMENTS = 0x241209;    // Segments 0 and 1 of every row
+static constexpr uint32_t LAST_ROW_SEGMENTS = 0x1008040;    // Segment 2 of every row
+static constexpr uint32_t BAND_COLUMNS = 0x1FF;
+static constexpr uint32_t FIRST_BOX_COLUMNS = 0xDB;         // Columns 0 and 1 of every box
+static constexpr uint32_t LAST_BOX_COLUMNS = 0x124;         // Column 2 of every box
+
+// Segments holding at least one cell, and at least two
+static inline LaneVector segmentsAny(LaneVector w)
+{
+    return laneAnd(laneOr(w, laneOr(laneShiftRight<1>(w), laneShiftRight<2>(w))), laneBroadcast(SEGMENT_BASES));
+}
+
+static inline LaneVector segmentsMany(LaneVector w)
+{
+    LaneVector second = laneShiftRight<1>(w);
+    LaneVector third = laneShiftRight<2>(w);
+    LaneVector pairs = laneOr(laneAnd(w, second), laneOr(laneAnd(w, third), laneAnd(second, third)));
+    return laneAnd(pairs, laneBroadcast(SEGMENT_BASES));
+}
+
+static inline LaneVector segmentCells(LaneVector segments)
+{
+    return laneOr(segments, laneOr(laneShiftLeft<1>(segments), laneShiftLeft<2>(segments)));
+}
+
+// The other two segments of the same row, and of the same box
+static inline LaneVector nextRowSegment(LaneVector segments)
+{
+    return laneOr(laneShiftLeft<3>(laneAnd(segments, laneBroadcast(FIRST_ROW_SEGMENTS))),
+                  laneShiftRight<6>(laneAnd(segments, laneBroadcast(LAST_ROW_SEGMENTS))));
+}
+
+static inline LaneVector otherRowSegments(LaneVector segments)
+{
+    LaneVector next = nextRowSegment(segments);
+    return laneOr(next, nextRowSegment(next));
+}
+
+static inline LaneVector otherBoxSegments(LaneVector segments)
+{
+    LaneVector down = laneOr(laneShiftLeft<9>(segments), laneShiftRight<18>(segments));
+    LaneVector up = laneOr(laneShiftLeft<18>(segments), laneShiftRight<9>(segments));
+    return laneAnd(laneOr(down, up), laneBroadcast(BAND_CELLS));
+}
+
+// Columns holding at least one cell of the band, and at least two
+static inline LaneVector columnsAny(LaneVector w)
+{
+    return laneAnd(laneOr(w, laneOr(laneShiftRight<9>(w), laneShiftRight<18>(w))), laneBroadcast(BAND_COLUMNS));
+}
+
+static inline LaneVector columnsMany(LaneVector w)
+{
+    LaneVector second = laneShiftRight<9>(w);
+    LaneVector third = laneShiftRight<18>(w);
+    LaneVector pairs = laneOr(laneAnd(w, second), laneOr(laneAnd(w, third), laneAnd(second, third)));
+    return laneAnd(pairs, laneBroadcast(BAND_COLUMNS));
+}
+
+static inline LaneVector columnCells(LaneVector columns)
+{
+    return laneOr(columns, laneOr(laneShiftLeft<9>(columns), laneShiftLeft<18>(columns)));
+}
+
+// The other two columns of the same box
+static inline LaneVector nextBoxColumn(LaneVector columns)
+{
+    return laneOr(laneShiftLeft<1>(laneAnd(columns, laneBroadcast(FIRST_BOX_COLUMNS))),
+                  laneShiftRight<2>(laneAnd(columns, laneBroadcast(LAST_BOX_COLUMNS))));
+}
+
+static inline LaneVector otherBoxColumns(LaneVector columns)
+{
+    LaneVector next = nextBoxColumn(columns);
+    return laneOr(next, nextBoxColumn(next));
+}
+
+// =================================================
+// Constructor & Destructor
+// =================================================
+
+SudokuBatchSolver::SudokuBatchSolver()
+    : m_block{}
+    , m_masks{}
+    , m_pending()
+    , m_stats()
+{
+}
+
+SudokuBatchSolver::~SudokuBatchSolver()
+{
+}
+
+// =================================================
+// Solving Methods
+// =================================================
+
+std::vector<bool> SudokuBatchSolver::solveAll(std::vector<SudokuBoard>& boards)
+{
+    std::vector<bool> results(boards.size(), false);
+    m_stats = SudokuBatchStats();
+
+    std::array<int, LANES> lanePuzzle;
+    lanePuzzle.fill(-1);
+
+    std::array<bool, LANES> laneBranched{};
+    size_t next = 0;
+
+    while (true) {
+        // ------------------------------------------------------
+        // Refill idle lanes; invalid givens fail before entering
+        // ------------------------------------------------------
+        bool anyActive = false;
+
+        for (int lane = 0; lane < LANES; ++lane) {
+            while (lanePuzzle[lane] < 0 && next < boards.size()) {
+                SudokuBitboardState state;
+                int index = static_cast<int>(next++);
+
+                if (SudokuBitboardSolver::loadState(boards[index], state)) {
+                    scatterLane(state, lane);
+                    lanePuzzle[lane] = index;
+                    laneBranched[lane] = false;
+                    m_pending[lane].clear();
+                } else {
+                    m_stats.unsolvable++;
+                }
+            }
+
+            m_masks.active[lane] = uint32_t(0) - static_cast<uint32_t>(lanePuzzle[lane] >= 0);
+            anyActive = anyActive || lanePuzzle[lane] >= 0;
+        }
+
+        if (!anyActive) {
+            break;
+        }
+
+        propagateRound();
+        m_stats.rounds++;
+
+        // ------------------------------------------------------
+        // Per-lane search step: backtrack on a contradiction, finish
+        // a full grid, branch when propagation stalls
+        // ------------------------------------------------------
+        for (int lane = 0; lane < LANES; ++lane) {
+            if (lanePuzzle[lane] < 0) {
+                continue;
+            }
+
+            int index = lanePuzzle[lane];
+
+            if (m_masks.dead[lane] != 0) {
+                if (!m_pending[lane].empty()) {
+                    scatterLane(m_pending[lane].back(), lane);
+                    m_pending[lane].pop_back();
+                } else {
+                    lanePuzzle[lane] = -1;
+                    m_stats.unsolvable++;
+                }
+            } else if (m_masks.complete[lane] != 0) {
+                SudokuBitboardState state;
+                gatherLane(lane, state);
+                SudokuBitboardSolver::writeSolution(state, boards[index]);
+                results[index] = true;
+                lanePuzzle[lane] = -1;
+
+                if (laneBranched[lane]) {
+                    m_stats.solvedBySearch++;
+                } else {
+                    m_stats.solvedByPropagation++;
+                }
+            } else if (m_masks.progress[lane] == 0) {
+                branchLane(lane);
+                laneBranched[lane] = true;
+            }
+        }
+    }
+
+    return results;
+}
+
+// =================================================
+// Private Helper Methods
+// =================================================
+
+void SudokuBatchSolver::propagateRound()
+{
+    LaneBlock& b = m_block;
+    const LaneVector bandCells = laneBroadcast(BAND_CELLS);
+
+    for (int base = 0; base < LANES; base += LANE_VECTOR_WIDTH) {
+        const LaneVector active = laneLoad(&m_masks.active[base]);
+
+        LaneVector solved[BANDS];
+        LaneVector planes[SUDOKU_SIZE][BANDS];
+
+        // ------------------------------------------------------
+        // Naked singles: bit-sliced count over the nine planes; an
+        // open cell in no plane is a dead end. Dead ends of every
+        // kind collect in one word, tested once at the end.
+        // ------------------------------------------------------
+        LaneVector naked[BANDS];
+        LaneVector deadCells = laneBroadcast(0);
+
+        for (int band = 0; band < BANDS; ++band) {
+            solved[band] = laneLoad(&b.solved[band][base]);
+
+            LaneVector once = laneBroadcast(0);
+            LaneVector twice = laneBroadcast(0);
+
+            for (int digit = 0; digit < SUDOKU_SIZE; ++digit) {
+                planes[digit][band] = laneLoad(&b.candidates[digit][band][base]);
+                twice = laneOr(twice, laneAnd(once, planes[digit][band]));
+                once = laneOr(once, planes[digit][band]);
+            }
+
+            LaneVector open = laneAndNot(bandCells, solved[band]);
+            deadCells = laneOr(deadCells, laneAndNot(open, once));
+            naked[band] = laneAnd(laneAndNot(once, twice), open);
+        }
+
+        // ------------------------------------------------------
+        // Hidden singles: a row, box or column where the digit fits
+        // one cell only; a unit where it fits none is a dead end.
+        // Placed digits are left out through the solved cells. The
+        // result is the cells placed this round, one plane per digit.
+        // ------------------------------------------------------
+        LaneVector place[SUDOKU_SIZE][BANDS];
+
+        for (int digit = 0; digit < SUDOKU_SIZE; ++digit) {
+            LaneVector columns[BANDS];
+            LaneVector columnPairs[BANDS];
+
+            for (int band = 0; band < BANDS; ++band) {
+                LaneVector plane = planes[digit][band];
+                LaneVector segments = segmentsAny(plane);
+                LaneVector sameRow = otherRowSegments(segments);
+                LaneVector sameBox = otherBoxSegments(segments);
+
+                // Alone in its row or in its box, and alone in its segment
+                LaneVector alone = laneAndNot(segments, laneOr(segmentsMany(plane), laneAnd(sameRow, sameBox)));
+
+                place[digit][band] = laneOr(laneAnd(plane, naked[band]), laneAnd(plane, segmentCells(alone)));
+                deadCells = laneOr(deadCells, laneAndNot(laneBroadcast(SEGMENT_BASES),
+                                                         laneOr(segments, laneAnd(sameRow, sameBox))));
+
+                columns[band] = columnsAny(plane);
+                columnPairs[band] = columnsMany(plane);
+            }
+
+            for (int band = 0; band < BANDS; ++band) {
+                LaneVector elsewhere = laneOr(columns[(band + 1) % BANDS], columns[(band + 2) % BANDS]);
+                LaneVector alone = laneAndNot(columns[band], laneOr(columnPairs[band], elsewhere));
+
+                place[digit][band] = laneOr(place[digit][band], laneAnd(planes[digit][band], columnCells(alone)));
+                place[digit][band] = laneAnd(laneAndNot(place[digit][band], solved[band]), active);
+            }
+
+            deadCells = laneOr(deadCells, laneAndNot(laneBroadcast(BAND_COLUMNS),
+                                                     laneOr(columns[0], laneOr(columns[1], columns[2]))));
+        }
+
+        // ------------------------------------------------------
+        // A cell placed with two different digits is a contradiction
+        // ------------------------------------------------------
+        LaneVector placed[BANDS];
+
+        for (int band = 0; band < BANDS; ++band) {
+            placed[band] = laneBroadcast(0);
+
+            for (int digit = 0; digit < SUDOKU_SIZE; ++digit) {
+                deadCells = laneOr(deadCells, laneAnd(placed[band], place[digit][band]));
+                placed[band] = laneOr(placed[band], place[digit][band]);
+            }
+        }
+
+        // ------------------------------------------------------
+        // Apply all placements at once: drop placed cells from the other
+        // planes, and each placed digit from the rest of its rows, boxes
+        // and columns; two placements of one digit in a unit are a
+        // contradiction
+        // ------------------------------------------------------
+        for (int digit = 0; digit < SUDOKU_SIZE; ++digit) {
+            LaneVector peers[BANDS];
+            LaneVector columns[BANDS];
+
+            for (int band = 0; band < BANDS; ++band) {
+                LaneVector cells = place[digit][band];
+                LaneVector segments = segmentsAny(cells);
+                LaneVector sameRow = otherRowSegments(segments);
+                LaneVector sameBox = otherBoxSegments(segments);
+
+                LaneVector crowded = laneOr(segmentsMany(cells), laneAnd(segments, laneOr(sameRow, sameBox)));
+                deadCells = laneOr(deadCells, laneOr(crowded, columnsMany(cells)));
+
+                peers[band] = segmentCells(laneOr(segments, laneOr(sameRow, sameBox)));
+                columns[band] = columnsAny(cells);
+            }
+
+            deadCells = laneOr(deadCells, laneOr(laneAnd(columns[0], columns[1]),
+                                                 laneAnd(columns[2], laneOr(columns[0], columns[1]))));
+            LaneVector columnPeers = columnCells(laneOr(columns[0], laneOr(columns[1], columns[2])));
+
+            for (int band = 0; band < BANDS; ++band) {
+                LaneVector cells = place[digit][band];
+                LaneVector cleared = laneAndNot(laneOr(laneOr(peers[band], columnPeers), placed[band]), cells);
+
+                laneStore(&b.candidates[digit][band][base], laneAndNot(planes[digit][band], cleared));
+            }
+        }
+
+        LaneVector complete = active;
+        LaneVector anyPlaced = laneBroadcast(0);
+
+        for (int band = 0; band < BANDS; ++band) {
+            LaneVector nextSolved = laneOr(solved[band], placed[band]);
+            laneStore(&b.solved[band][base], nextSolved);
+
+            complete = laneAnd(complete, laneIsZero(laneAndNot(bandCells, nextSolved)));
+            anyPlaced = laneOr(anyPlaced, placed[band]);
+        }
+
+        laneStore(&m_masks.dead[base], laneAndNot(active, laneIsZero(deadCells)));
+        laneStore(&m_masks.progress[base], laneAndNot(active, laneIsZero(anyPlaced)));
+        laneStore(&m_masks.complete[base], complete);
+    }
+
+    eliminateLockedCandidates();
+}
+
+void SudokuBatchSolver::eliminateLockedCandidates()
+{
+    // ------------------------------------------------------
+    // Only stalled lanes take part; the others keep their planes
+    // through an all-zero lane mask. One test skips the pass when
+    // no lane has stalled.
+    // ------------------------------------------------------
+    alignas(64) std::array<uint32_t, LANES> stalled;
+    uint32_t anyStalled = 0;
+
+    for (int lane = 0; lane < LANES; ++lane) {
+        stalled[lane] = m_masks.active[lane] & ~(m_masks.dead[lane] | m_masks.progress[lane] | m_masks.complete[lane]);
+        anyStalled |= stalled[lane];
+    }
+
+    if (anyStalled == 0) {
+        return;
+    }
+
+    // ------------------------------------------------------
+    // Pointing: a digit confined to one row (column) within a box
+    // leaves the rest of that row (column). Claiming: confined to
+    // one box within a row (column), it leaves the rest of the box.
+    // All intersections are tested on the same open cells, so what
+    // one elimination exposes is found in the next round; the
+    // propagation still stalls at the same state.
+    // ------------------------------------------------------
+    LaneBlock& b = m_block;
+
+    for (int base = 0; base < LANES; base += LANE_VECTOR_WIDTH) {
+        const LaneVector laneMask = laneLoad(&stalled[base]);
+        LaneVector changed = laneBroadcast(0);
+
+        for (int digit = 0; digit < SUDOKU_SIZE; ++digit) {
+            LaneVector open[BANDS];
+            LaneVector columns[BANDS];
+            LaneVector eliminated[BANDS];
+
+            for (int band = 0; band < BANDS; ++band) {
+                open[band] = laneAndNot(laneLoad(&b.candidates[digit][band][base]), laneLoad(&b.solved[band][base]));
+                columns[band] = columnsAny(open[band]);
+            }
+
+            for (int band = 0; band < BANDS; ++band) {
+                LaneVector segments = segmentsAny(open[band]);
+                LaneVector boxPointing = laneAndNot(segments, otherBoxSegments(segments));
+                LaneVector rowClaiming = laneAndNot(segments, otherRowSegments(segments));
+
+                LaneVector elsewhere = laneOr(columns[(band + 1) % BANDS], columns[(band + 2) % BANDS]);
+                LaneVector columnClaiming = laneAndNot(columns[band], elsewhere);
+
+                LaneVector segmentTargets = laneOr(otherRowSegments(boxPointing), otherBoxSegments(rowClaiming));
+                eliminated[band] = laneOr(segmentCells(segmentTargets), columnCells(otherBoxColumns(columnClaiming)));
+            }
+
+            for (int band = 0; band < BANDS; ++band) {
+                LaneVector boxPointing = laneAndNot(columns[band], otherBoxColumns(columns[band]));
+                LaneVector columnCellsHere = columnCells(boxPointing);
+
+                eliminated[(band + 1) % BANDS] = laneOr(eliminated[(band + 1) % BANDS], columnCellsHere);
+                eliminated[(band + 2) % BANDS] = laneOr(eliminated[(band + 2) % BANDS], columnCellsHere);
+            }
+
+            for (int band = 0; band < BANDS; ++band) {
+                LaneVector removed = laneAnd(laneAnd(eliminated[band], open[band]), laneMask);
+                LaneVector plane = laneLoad(&b.candidates[digit][band][base]);
+
+                laneStore(&b.candidates[digit][band][base], laneAndNot(plane, removed));
+                changed = laneOr(changed, removed);
+            }
+        }
+
+        LaneVector progress = laneLoad(&m_masks.progress[base]);
+        laneStore(&m_masks.progress[base], laneOr(progress, laneNot(laneIsZero(changed))));
+    }
+}
+
+void SudokuBatchSolver::branchLane(int lane)
+{
+    // ------------------------------------------------------
+    // Same cell and digit order as the scalar search: the lowest
+    // digit goes on in the lane, the others wait on its stack with
+    // the next digit on top
+    // ------------------------------------------------------
+    SudokuBitboardState state;
+    gatherLane(lane, state);
+
+    int cell = SudokuBitboardSolver::chooseBranchCell(state);
+    int digits[SUDOKU_SIZE] = {};
+    int digitCount = 0;
+
+    for (int digit = 0; digit < SUDOKU_SIZE; ++digit) {
+        if (state.candidates[digit].test(cell)) {
+            digits[digitCount++] = digit;
+        }
+    }
+
+    for (int i = digitCount - 1; i > 0; --i) {
+        m_pending[lane].push_back(state);
+        SudokuBitboardSolver::assign(m_pending[lane].back(), cell, digits[i]);
+    }
+
+    SudokuBitboardSolver::assign(state, cell, digits[0]);
+    scatterLane(state, lane);
+    m_stats.branches++;
+}
+
+void SudokuBatchSolver::scatterLane(const SudokuBitboardState& state, int lane)
+{
+    // ------------------------------------------------------
+    // Split the (lo, hi) bitboard into three 27-cell bands
+    // ------------------------------------------------------
+    auto toBands = [](const SudokuBitboard& board, std::array<std::array<uint32_t, LANES>, BANDS>& bands, int at) {
+        bands[0][at] = static_cast<uint32_t>(board.lo & BAND_CELLS);
+        bands[1][at] = static_cast<uint32_t>((board.lo >> 27) & BAND_CELLS);
+        bands[2][at] = static_cast<uint32_t>(((board.lo >> 54) | (board.hi << 10)) & BAND_CELLS);
+    };
+
+    for (int digit = 0; digit < SUDOKU_SIZE; ++digit) {
+        toBands(state.candidates[digit], m_block.candidates[digit], lane);
+    }
+    toBands(state.solved, m_block.solved, lane);
+}
+
+void SudokuBatchSolver::gatherLane(int lane, SudokuBitboardState& state) const
+{
+    auto fromBands = [lane](const std::array<std::array<uint32_t, LANES>, BANDS>& bands) {
+        uint64_t lo = bands[0][lane] | (uint64_t(bands[1][lane]) << 27) | (uint64_t(bands[2][lane]) << 54);
+        uint64_t hi = uint64_t(bands[2][lane]) >> 10;
+        return SudokuBitboard{lo, hi};
+    };
+
+    state.solved = fromBands(m_block.solved);
+    state.values.fill(0);
+
+    // ------------------------------------------------------
+    // A filled cell is left in exactly one plane: its digit's
+    // ------------------------------------------------------
+    for (int digit = 0; digit < SUDOKU_SIZE; ++digit) {
+        state.candidates[digit] = fromBands(m_block.candidates[digit]);
+
+        (state.candidates[digit] & state.solved).forEachCell([&state, digit](int cell) {
+            state.values[cell] = static_cast<uint8_t>(digit + 1);
+        });
+    }
+}
@@ -0,0 +1,117 @@
+/**
+ * @file SudokuBatchSolver.hpp
+ * @brief Lane-parallel propagation for solving many puzzles at once
+ *
+ * This header defines a throughput-oriented solver for bulk workloads. It
+ * keeps several independent puzzles in an interleaved (struct-of-arrays)
+ * block of band words: each digit plane is three 27-bit words, one per
+ * band of three rows, so every row and box sits inside one word. A
+ * propagation round (naked and hidden singles, placing their digits,
+ * box/line eliminations) is then shifts and masks over whole bands, run
+ * as explicit SSE2 or AVX2 operations over all lanes, with per-lane
+ * outcomes kept as masks instead of branches.
+ *
+ * Each lane also runs its own depth-first search: a lane that stalls
+ * branches on the same cell and in the same digit order as the scalar
+ * bitboard solver, keeps the other choices on its own stack, and pops the
+ * next one when a choice fails. Lanes that finish are refilled from the
+ * input, so the block stays full until the last puzzles.
+ *
+ * Results follow the SudokuSolver contract: a solved board has its empty
+ * cells filled in, and an unsolvable board is left unchanged.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#pragma once
+
+#include "SudokuBoard.hpp"
+#include "SudokuBitboardSolver.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// =================================================
+// Batch Statistics
+// =================================================
+
+struct SudokuBatchStats
+{
+    size_t solvedByPropagation = 0;   // Finished without branching
+    size_t solvedBySearch = 0;        // Needed at least one branch
+    size_t unsolvable = 0;
+    size_t rounds = 0;                // Propagation rounds over the block
+    size_t branches = 0;              // Stalled lanes that guessed
+};
+
+// =================================================
+// SudokuBatchSolver Class
+// =================================================
+
+class SudokuBatchSolver
+{
+public:
+    static constexpr int LANES = 8;   // Puzzles propagated together
+
+    // ------------------------------------------------------
+    // Constructor & Destructor
+    // ------------------------------------------------------
+    SudokuBatchSolver();
+    ~SudokuBatchSolver();
+
+    // ------------------------------------------------------
+    // Solving Methods
+    // ------------------------------------------------------
+    std::vector<bool> solveAll(std::vector<SudokuBoard>& boards);
+
+    // ------------------------------------------------------
+    // Statistics
+    // ------------------------------------------------------
+    const SudokuBatchStats& getStats() const { return m_stats; }
+
+private:
+    // ------------------------------------------------------
+    // Interleaved lane state: element [..][lane] of every array
+    // belongs to one puzzle, so loops over lanes are contiguous.
+    // Cell c is bit c % 27 of band c / 27.
+    // ------------------------------------------------------
+    static constexpr int BANDS = 3;
+
+    struct LaneBlock
+    {
+        alignas(64) std::array<std::array<std::array<uint32_t, LANES>, BANDS>, SUDOKU_SIZE> candidates;
+        alignas(64) std::array<std::array<uint32_t, LANES>, BANDS> solved;
+    };
+
+    // ------------------------------------------------------
+    // Per-lane outcome of a round, all-ones or zero per lane
+    // ------------------------------------------------------
+    struct LaneMasks
+    {
+        alignas(64) std::array<uint32_t, LANES> active;
+        alignas(64) std::array<uint32_t, LANES> dead;       // Contradiction found
+        alignas(64) std::array<uint32_t, LANES> progress;   // Placed or eliminated something
+        alignas(64) std::array<uint32_t, LANES> complete;   // Every cell filled
+    };
+
+    // ------------------------------------------------------
+    // Private Data Members
+    // ------------------------------------------------------
+    LaneBlock m_block;
+    LaneMasks m_masks;
+    std::array<std::vector<SudokuBitboardState>, LANES> m_pending;   // Untried branches, per lane
+    SudokuBatchStats m_stats;
+
+    // ------------------------------------------------------
+    // Private Helper Methods
+    // ------------------------------------------------------
+    void propagateRound();
+    void eliminateLockedCandidates();
+    void branchLane(int lane);
+    void scatterLane(const SudokuBitboardState& state, int lane);
+    void gatherLane(int lane, SudokuBitboardState& state) const;
+};
@@ -0,0 +1,274 @@
+/**
+ * @file SudokuBitboard.hpp
+ * @brief 81-bit cell sets held in one 128-bit vector register
+ *
+ * This header defines the bitboard type used by the bitboard solver engine:
+ * one bit per cell (row-major, bits 0-63 in the low word, 64-80 in the high
+ * word). Set operations compile to single SSE2 instructions where available
+ * and to paired 64-bit operations elsewhere, including inside constant
+ * expressions, so the engine built on them also runs at compile time. It
+ * also builds, at compile time, the bitboards of every cell, peer set, unit
+ * and box/line intersection.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#pragma once
+
+#include "SudokuTables.hpp"
+#include <array>
+#include <cstdint>
+
+// ------------------------------------------------------
+// Intrinsics are not constant expressions, so the SSE2 path
+// needs a way to step aside while the compiler evaluates one
+// ------------------------------------------------------
+#if (defined(__GNUC__) && __GNUC__ >= 9) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define SUDOKU_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#define SUDOKU_HAS_CONSTANT_EVALUATED 1
+#else
+#define SUDOKU_HAS_CONSTANT_EVALUATED 0
+#endif
+
+#if SUDOKU_HAS_CONSTANT_EVALUATED && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SUDOKU_BITBOARD_SSE2 1
+#include <emmintrin.h>
+#else
+#define SUDOKU_BITBOARD_SSE2 0
+#endif
+
+// =================================================
+// Bit helpers
+// =================================================
+
+constexpr int bitboardPopCount(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    int count = 0;
+    while (word != 0) {
+        word &= word - 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+constexpr int bitboardLowestBit(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int index = 0;
+    while ((word & 1) == 0) {
+        word >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+// =================================================
+// SudokuBitboard Structure
+// =================================================
+
+struct alignas(16) SudokuBitboard
+{
+    uint64_t lo;   // Cells 0-63
+    uint64_t hi;   // Cells 64-80
+
+    static constexpr SudokuBitboard fromCell(int cell)
+    {
+        return cell < 64 ? SudokuBitboard{uint64_t(1) << cell, 0}
+                         : SudokuBitboard{0, uint64_t(1) << (cell - 64)};
+    }
+
+    constexpr bool test(int cell) const
+    {
+        return cell < 64 ? ((lo >> cell) & 1) != 0 : ((hi >> (cell - 64)) & 1) != 0;
+    }
+
+    constexpr bool any() const { return (lo | hi) != 0; }
+    constexpr bool none() const { return (lo | hi) == 0; }
+
+    constexpr int count() const { return bitboardPopCount(lo) + bitboardPopCount(hi); }
+
+    // Exactly one bit set
+    constexpr bool isSingleCell() const
+    {
+        return (lo == 0) != (hi == 0) && (lo & (lo - 1)) == 0 && (hi & (hi - 1)) == 0;
+    }
+
+    // Only valid when any() is true
+    constexpr int lowestCell() const
+    {
+        return lo != 0 ? bitboardLowestBit(lo) : 64 + bitboardLowestBit(hi);
+    }
+
+    // Calls func(cell) for every set bit, lowest cell first
+    template <typename Func>
+    constexpr void forEachCell(Func func) const
+    {
+        for (uint64_t word = lo; word != 0; word &= word - 1) {
+            func(bitboardLowestBit(word));
+        }
+        for (uint64_t word = hi; word != 0; word &= word - 1) {
+            func(64 + bitboardLowestBit(word));
+        }
+    }
+};
+
+// ------------------------------------------------------
+// Set operations
+// ------------------------------------------------------
+
+#if SUDOKU_BITBOARD_SSE2
+
+inline __m128i bitboardLoad(const SudokuBitboard& board)
+{
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(&board));
+}
+
+inline SudokuBitboard bitboardStore(__m128i bits)
+{
+    SudokuBitboard board;
+    _mm_store_si128(reinterpret_cast<__m128i*>(&board), bits);
+    return board;
+}
+
+#endif
+
+constexpr SudokuBitboard operator&(const SudokuBitboard& a, const SudokuBitboard& b)
+{
+#if SUDOKU_BITBOARD_SSE2
+    if (!SUDOKU_CONSTANT_EVALUATED()) {
+        return bitboardStore(_mm_and_si128(bitboardLoad(a), bitboardLoad(b)));
+    }
+#endif
+    return {a.lo & b.lo, a.hi & b.hi};
+}
+
+constexpr SudokuBitboard operator|(const SudokuBitboard& a, const SudokuBitboard& b)
+{
+#if SUDOKU_BITBOARD_SSE2
+    if (!SUDOKU_CONSTANT_EVALUATED()) {
+        return bitboardStore(_mm_or_si128(bitboardLoad(a), bitboardLoad(b)));
+    }
+#endif
+    return {a.lo | b.lo, a.hi | b.hi};
+}
+
+constexpr SudokuBitboard operator^(const SudokuBitboard& a, const SudokuBitboard& b)
+{
+#if SUDOKU_BITBOARD_SSE2
+    if (!SUDOKU_CONSTANT_EVALUATED()) {
+        return bitboardStore(_mm_xor_si128(bitboardLoad(a), bitboardLoad(b)));
+    }
+#endif
+    return {a.lo ^ b.lo, a.hi ^ b.hi};
+}
+
+// a & ~b
+constexpr SudokuBitboard andNot(const SudokuBitboard& a, const SudokuBitboard& b)
+{
+#if SUDOKU_BITBOARD_SSE2
+    if (!SUDOKU_CONSTANT_EVALUATED()) {
+        return bitboardStore(_mm_andnot_si128(bitboardLoad(b), bitboardLoad(a)));
+    }
+#endif
+    return {a.lo & ~b.lo, a.hi & ~b.hi};
+}
+
+constexpr SudokuBitboard& operator&=(SudokuBitboard& a, const SudokuBitboard& b) { return a = a & b; }
+constexpr SudokuBitboard& operator|=(SudokuBitboard& a, const SudokuBitboard& b) { return a = a | b; }
+
+constexpr bool operator==(const SudokuBitboard& a, const SudokuBitboard& b)
+{
+    return a.lo == b.lo && a.hi == b.hi;
+}
+
+constexpr bool operator!=(const SudokuBitboard& a, const SudokuBitboard& b)
+{
+    return !(a == b);
+}
+
+// =================================================
+// Compile-time bitboard tables
+// =================================================
+
+inline constexpr int BOX_LINE_INTERSECTIONS = 54;   // 9 boxes x (3 rows + 3 columns)
+
+struct SudokuBitboardTables
+{
+    SudokuBitboard all;                                          // All 81 cells
+    std::array<SudokuBitboard, SUDOKU_CELLS> cells;              // Single cell
+    std::array<SudokuBitboard, SUDOKU_CELLS> peers;              // 20 peers of a cell
+    std::array<SudokuBitboard, SUDOKU_UNITS> units;              // 9 cells of a unit
+    std::array<uint8_t, BOX_LINE_INTERSECTIONS> intersectionBox;    // Box unit index
+    std::array<uint8_t, BOX_LINE_INTERSECTIONS> intersectionLine;   // Row or column unit index
+    std::array<SudokuBitboard, BOX_LINE_INTERSECTIONS> intersections;  // 3 shared cells
+};
+
+constexpr SudokuBitboard makeBitboardUnion(SudokuBitboard a, SudokuBitboard b)
+{
+    return {a.lo | b.lo, a.hi | b.hi};
+}
+
+constexpr SudokuBitboardTables makeSudokuBitboardTables()
+{
+    SudokuBitboardTables tables{};
+
+    // ------------------------------------------------------
+    // Cells, peers and units from the shared index tables
+    // ------------------------------------------------------
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        tables.cells[cell] = SudokuBitboard::fromCell(cell);
+        tables.all = makeBitboardUnion(tables.all, tables.cells[cell]);
+
+        for (uint8_t peer : SUDOKU_TABLES.peers[cell]) {
+            tables.peers[cell] = makeBitboardUnion(tables.peers[cell], SudokuBitboard::fromCell(peer));
+        }
+    }
+
+    for (int unit = 0; unit < SUDOKU_UNITS; ++unit) {
+        for (uint8_t cell : SUDOKU_TABLES.unitCells[unit]) {
+            tables.units[unit] = makeBitboardUnion(tables.units[unit], SudokuBitboard::fromCell(cell));
+        }
+    }
+
+    // ------------------------------------------------------
+    // Box/line intersections: the three rows and three columns
+    // crossing each box
+    // ------------------------------------------------------
+    int index = 0;
+
+    for (int box = 0; box < 9; ++box) {
+        int boxUnit = BOX_UNIT_BASE + box;
+
+        for (int i = 0; i < 3; ++i) {
+            int lines[2] = {ROW_UNIT_BASE + (box / 3) * 3 + i, COL_UNIT_BASE + (box % 3) * 3 + i};
+
+            for (int line : lines) {
+                SudokuBitboard shared = {tables.units[boxUnit].lo & tables.units[line].lo,
+                                         tables.units[boxUnit].hi & tables.units[line].hi};
+                tables.intersectionBox[index] = static_cast<uint8_t>(boxUnit);
+                tables.intersectionLine[index] = static_cast<uint8_t>(line);
+                tables.intersections[index] = shared;
+                ++index;
+            }
+        }
+    }
+
+    return tables;
+}
+
+inline constexpr SudokuBitboardTables SUDOKU_BITBOARDS = makeSudokuBitboardTables();
+
+static_assert(SUDOKU_BITBOARDS.all.hi == (uint64_t(1) << (SUDOKU_CELLS - 64)) - 1, "81 cells span 17 high bits");
+static_assert(SUDOKU_BITBOARDS.units[ROW_UNIT_BASE].lo == 0x1FF, "Row 0 is cells 0-8");
+static_assert(SUDOKU_BITBOARDS.intersections[0].lo == 0x7, "Box 0 meets row 0 at cells 0-2");
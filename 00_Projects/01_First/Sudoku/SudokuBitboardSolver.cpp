@@ -0,0 +1,214 @@
+/**
+ * @file SudokuBitboardSolver.cpp
+ * @brief Implementation of the bitboard solver engine
+ *
+ * This file implements constraint propagation over digit-plane bitboards
+ * and the minimum-remaining-values search built on top of it, once for
+ * any rule view; the classic and variant engines are its two instantiations.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#include "SudokuBitboardSolver.hpp"
+#include <algorithm>
+
+// =================================================
+// Constructor & Destructor
+// =================================================
+
+SudokuBitboardSolver::SudokuBitboardSolver()
+    : m_stepCount(0)
+    , m_cancel(nullptr)
+    , m_rules()
+    , m_countCacheHits(0)
+{
+}
+
+SudokuBitboardSolver::~SudokuBitboardSolver()
+{
+}
+
+// =================================================
+// Solving Methods
+// =================================================
+
+bool SudokuBitboardSolver::solve(SudokuBoard& board)
+{
+    return solve(board, SolveLimits{}).status == SolveStatus::SOLVED;
+}
+
+bool SudokuBitboardSolver::hasSolution(const SudokuBoard& board)
+{
+    return countSolutions(board, 1) > 0;
+}
+
+int SudokuBitboardSolver::countSolutions(const SudokuBoard& board, int maxCount)
+{
+    return countSolutions(board, maxCount, SolveLimits{}).solutionCount;
+}
+
+SolveResult SudokuBitboardSolver::solve(SudokuBoard& board, const SolveLimits& limits)
+{
+    if (!m_rules.isClassic()) {
+        return solveWith(board, limits, m_rules.getView());
+    }
+    return solveWith(board, limits, SudokuClassicRules{});
+}
+
+SolveResult SudokuBitboardSolver::countSolutions(const SudokuBoard& board, int maxCount, const SolveLimits& limits)
+{
+    if (!m_rules.isClassic()) {
+        return countWith(board, maxCount, limits, m_rules.getView());
+    }
+    return countWith(board, maxCount, limits, SudokuClassicRules{});
+}
+
+// =================================================
+// Configuration
+// =================================================
+
+void SudokuBitboardSolver::setRuleSet(const SudokuRuleSet& rules)
+{
+    // Cached counts hold for the rules they were counted under
+    m_rules = rules;
+    m_countCache.clear();
+}
+
+void SudokuBitboardSolver::clearCountCache()
+{
+    m_countCache.clear();
+    m_countCacheHits = 0;
+}
+
+// =================================================
+// Engine Primitives
+// =================================================
+
+bool SudokuBitboardSolver::loadState(const SudokuBoard& board, SudokuBitboardState& state)
+{
+    return loadState(board, state, SudokuClassicRules{});
+}
+
+bool SudokuBitboardSolver::assign(SudokuBitboardState& state, int cell, int digit)
+{
+    return assign(state, cell, digit, SudokuClassicRules{});
+}
+
+bool SudokuBitboardSolver::propagate(SudokuBitboardState& state)
+{
+    return propagate(state, SudokuClassicRules{});
+}
+
+void SudokuBitboardSolver::writeSolution(const SudokuBitboardState& state, SudokuBoard& board)
+{
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        int row = SUDOKU_TABLES.cellRow[cell];
+        int col = SUDOKU_TABLES.cellCol[cell];
+
+        if (board.isEmpty(row, col)) {
+            board.setValue(row, col, state.values[cell]);
+        }
+    }
+}
+
+// =================================================
+// Engine over a Rule View
+// =================================================
+
+template <typename Rules>
+SolveResult SudokuBitboardSolver::solveWith(SudokuBoard& board, const SolveLimits& limits, const Rules& rules)
+{
+    m_stepCount = 0;
+    m_budget.start(limits, m_cancel);
+
+    SudokuBitboardState state;
+    if (!loadState(board, state, rules)) {
+        return m_budget.finish(0, 0);
+    }
+
+    SudokuBitboardState solution;
+    if (search(state, 1, &solution, rules) == 0) {
+        return m_budget.finish(0, m_stepCount);
+    }
+
+    writeSolution(solution, board);
+    return m_budget.finish(1, m_stepCount);
+}
+
+template <typename Rules>
+SolveResult SudokuBitboardSolver::countWith(const SudokuBoard& board, int maxCount, const SolveLimits& limits,
+                                            const Rules& rules)
+{
+    m_stepCount = 0;
+    m_budget.start(limits, m_cancel);
+
+    // ------------------------------------------------------
+    // A board counted before needs no search when its stored
+    // count is exact or already reaches this maxCount
+    // ------------------------------------------------------
+    if (m_countCache.empty()) {
+        m_countCache.resize(COUNT_CACHE_ENTRIES);
+    }
+
+    uint64_t key = board.getHash();
+    CountEntry& entry = m_countCache[key & (COUNT_CACHE_ENTRIES - 1)];
+    if (entry.key == key && (entry.exact || entry.count >= maxCount)) {
+        ++m_countCacheHits;
+        return m_budget.finish(std::min(static_cast<int>(entry.count), maxCount), 0);
+    }
+
+    SudokuBitboardState state;
+    if (!loadState(board, state, rules)) {
+        return m_budget.finish(0, 0);
+    }
+
+    int solutionCount = search(state, maxCount, nullptr, rules);
+
+    // Store the count unless the budget cut the search short
+    if (!m_budget.wasExhausted()) {
+        entry.key = key;
+        entry.count = solutionCount;
+        entry.exact = solutionCount < maxCount;
+    }
+    return m_budget.finish(solutionCount, m_stepCount);
+}
+
+template <typename Rules>
+bool SudokuBitboardSolver::loadState(const SudokuBoard& board, SudokuBitboardState& state, const Rules& rules)
+{
+    // ------------------------------------------------------
+    // Every digit is possible everywhere until the givens are placed;
+    // a given that is no longer a candidate means a duplicate
+    // ------------------------------------------------------
+    state = emptyState();
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        int value = board.getValue(SUDOKU_TABLES.cellRow[cell], SUDOKU_TABLES.cellCol[cell]);
+
+        if (value != 0 && !assign(state, cell, value - 1, rules)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Rules>
+int SudokuBitboardSolver::search(SudokuBitboardState& state, int maxCount, SudokuBitboardState* solution,
+                                 const Rules& rules)
+{
+    // ------------------------------------------------------
+    // The shared constexpr search, with this solver's budget as
+    // the node limit; nodes carry on from the current step count
+    // ------------------------------------------------------
+    SudokuSearchStats stats;
+    stats.nodes = static_cast<uint64_t>(m_stepCount);
+
+    int solutionCount = searchState(state, maxCount, solution, rules, stats,
+                                    [this](uint64_t nodes) { return m_budget.exhausted(nodes); });
+
+    m_stepCount = static_cast<int>(stats.nodes);
+    return solutionCount;
+}
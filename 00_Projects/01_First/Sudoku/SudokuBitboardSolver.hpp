@@ -0,0 +1,540 @@
+/**
+ * @file SudokuBitboardSolver.hpp
+ * @brief Bitboard solver engine for low-latency solving
+ *
+ * This header defines a solver with the same interface as SudokuSolver that
+ * keeps candidates as nine digit planes of 81-bit bitboards. Naked singles,
+ * hidden singles and box/line (locked candidate) eliminations are computed
+ * with whole-board vector operations, and the search branches on the cell
+ * with the fewest candidates.
+ *
+ * The engine is written once over a rule view (see SudokuRuleSet.hpp).
+ * Classic boards run the instantiation on the compile-time classic tables;
+ * a variant rule set, when one is set, runs the same code on its tables,
+ * including Killer cage pruning through the sum-combination tables.
+ *
+ * Counting jobs are memoized by the board's Zobrist hash in a bounded
+ * table kept across calls, so a board counted again (a repeated daemon
+ * request, or a pool re-checking the generator's last uniqueness check)
+ * costs one probe instead of a search.
+ *
+ * The engine itself (assign, propagate, searchState) is constexpr and
+ * defined in this header, so SudokuBundledPuzzles.hpp solves and rates the
+ * built-in puzzles with the same code while compiling.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#pragma once
+
+#include "SudokuBoard.hpp"
+#include "SudokuBitboard.hpp"
+#include "SudokuRuleSet.hpp"
+#include "SudokuSolveLimits.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+// =================================================
+// Search State
+// =================================================
+
+struct SudokuBitboardState
+{
+    std::array<SudokuBitboard, SUDOKU_SIZE> candidates;   // Plane d: cells that may hold d + 1
+    SudokuBitboard solved;                                // Cells with a value
+    std::array<uint8_t, SUDOKU_CELLS> values;             // 0 = empty, 1-9 = filled
+};
+
+struct SudokuSearchStats
+{
+    uint64_t nodes = 0;      // Search calls
+    uint64_t branches = 0;   // Nodes that had to guess
+};
+
+// =================================================
+// SudokuBitboardSolver Class
+// =================================================
+
+class SudokuBitboardSolver
+{
+public:
+    // ------------------------------------------------------
+    // Constructor & Destructor
+    // ------------------------------------------------------
+    SudokuBitboardSolver();
+    ~SudokuBitboardSolver();
+
+    // ------------------------------------------------------
+    // Solving Methods
+    // ------------------------------------------------------
+    bool solve(SudokuBoard& board);
+    bool hasSolution(const SudokuBoard& board);
+    int countSolutions(const SudokuBoard& board, int maxCount = 2);
+
+    // ------------------------------------------------------
+    // Budgeted Solving (node budget and/or deadline)
+    // ------------------------------------------------------
+    SolveResult solve(SudokuBoard& board, const SolveLimits& limits);
+    SolveResult countSolutions(const SudokuBoard& board, int maxCount, const SolveLimits& limits);
+
+    // ------------------------------------------------------
+    // Statistics
+    // ------------------------------------------------------
+    int getStepCount() const { return m_stepCount; }
+    void resetStepCount() { m_stepCount = 0; }
+
+    // ------------------------------------------------------
+    // Count cache (solution counting)
+    // ------------------------------------------------------
+    void clearCountCache();
+    uint64_t getCountCacheHits() const { return m_countCacheHits; }
+
+    // ------------------------------------------------------
+    // Cooperative cancellation (portfolio races)
+    // ------------------------------------------------------
+    void setCancelFlag(const std::atomic<bool>* cancel) { m_cancel = cancel; }
+
+    // ------------------------------------------------------
+    // Variant rules (classic by default)
+    // ------------------------------------------------------
+    void setRuleSet(const SudokuRuleSet& rules);
+    const SudokuRuleSet& getRuleSet() const { return m_rules; }
+
+    // ------------------------------------------------------
+    // Engine primitives on classic rules (shared with the batch solver)
+    // ------------------------------------------------------
+    static bool loadState(const SudokuBoard& board, SudokuBitboardState& state);
+    static bool assign(SudokuBitboardState& state, int cell, int digit);
+    static bool propagate(SudokuBitboardState& state);
+    static constexpr bool isComplete(const SudokuBitboardState& state);
+    static void writeSolution(const SudokuBitboardState& state, SudokuBoard& board);
+    static constexpr int chooseBranchCell(const SudokuBitboardState& state);
+
+    // ------------------------------------------------------
+    // Engine over a rule view (SudokuClassicRules or
+    // SudokuVariantRules); constexpr, so it also runs at compile
+    // time. searchState gives up once exhausted(nodes) is true.
+    // ------------------------------------------------------
+    static constexpr SudokuBitboardState emptyState();
+    template <typename Rules>
+    static constexpr bool assign(SudokuBitboardState& state, int cell, int digit, const Rules& rules);
+    template <typename Rules>
+    static constexpr bool propagate(SudokuBitboardState& state, const Rules& rules);
+    template <typename Rules, typename Exhausted>
+    static constexpr int searchState(SudokuBitboardState& state, int maxCount, SudokuBitboardState* solution,
+                                     const Rules& rules, SudokuSearchStats& stats, Exhausted exhausted);
+
+private:
+    // ------------------------------------------------------
+    // Memoized count of a whole board under the current rules:
+    // exact, or a lower bound that already reached the maxCount
+    // of the job that stored it
+    // ------------------------------------------------------
+    struct CountEntry
+    {
+        uint64_t key = 0;     // Board hash
+        int32_t count = 0;
+        bool exact = false;
+    };
+
+    static constexpr size_t COUNT_CACHE_ENTRIES = size_t(1) << 12;   // Power of two, 64 KiB total
+
+    // ------------------------------------------------------
+    // Private Data Members
+    // ------------------------------------------------------
+    int m_stepCount;
+    const std::atomic<bool>* m_cancel;   // Search gives up once this is set
+    SudokuRuleSet m_rules;
+    SolveBudget m_budget;
+    std::vector<CountEntry> m_countCache;   // Direct-mapped, allocated on first count
+    uint64_t m_countCacheHits;
+
+    // ------------------------------------------------------
+    // Engine over a rule view (SudokuClassicRules or SudokuVariantRules)
+    // ------------------------------------------------------
+    template <typename Rules>
+    SolveResult solveWith(SudokuBoard& board, const SolveLimits& limits, const Rules& rules);
+    template <typename Rules>
+    SolveResult countWith(const SudokuBoard& board, int maxCount, const SolveLimits& limits, const Rules& rules);
+    template <typename Rules>
+    int search(SudokuBitboardState& state, int maxCount, SudokuBitboardState* solution, const Rules& rules);
+
+    template <typename Rules>
+    static bool loadState(const SudokuBoard& board, SudokuBitboardState& state, const Rules& rules);
+    template <typename Rules>
+    static constexpr bool assignNakedSingles(SudokuBitboardState& state, bool& progress, const Rules& rules);
+    template <typename Rules>
+    static constexpr bool assignHiddenSingles(SudokuBitboardState& state, bool& progress, const Rules& rules);
+    template <typename Rules>
+    static constexpr bool eliminateCageCombinations(SudokuBitboardState& state, bool& progress, const Rules& rules);
+    template <typename Rules>
+    static constexpr bool eliminateLockedCandidates(SudokuBitboardState& state, const Rules& rules);
+};
+
+// =================================================
+// Engine over a Rule View
+// =================================================
+
+constexpr bool SudokuBitboardSolver::isComplete(const SudokuBitboardState& state)
+{
+    return state.solved == SUDOKU_BITBOARDS.all;
+}
+
+constexpr SudokuBitboardState SudokuBitboardSolver::emptyState()
+{
+    // Every digit is possible everywhere until something is placed
+    SudokuBitboardState state{};
+    for (auto& plane : state.candidates) {
+        plane = SUDOKU_BITBOARDS.all;
+    }
+    return state;
+}
+
+template <typename Rules>
+constexpr bool SudokuBitboardSolver::assign(SudokuBitboardState& state, int cell, int digit, const Rules& rules)
+{
+    if (!state.candidates[digit].test(cell)) {
+        return false;
+    }
+
+    if (state.values[cell] != 0) {
+        return true;
+    }
+
+    // ------------------------------------------------------
+    // Remove the cell from every other plane and the digit from its peers
+    // ------------------------------------------------------
+    const SudokuBitboard& cellBit = SUDOKU_BITBOARDS.cells[cell];
+
+    for (auto& plane : state.candidates) {
+        plane = andNot(plane, cellBit);
+    }
+
+    state.candidates[digit] = andNot(state.candidates[digit], rules.tables().peers[cell]) | cellBit;
+    state.solved |= cellBit;
+    state.values[cell] = static_cast<uint8_t>(digit + 1);
+    return true;
+}
+
+template <typename Rules>
+constexpr bool SudokuBitboardSolver::propagate(SudokuBitboardState& state, const Rules& rules)
+{
+    // ------------------------------------------------------
+    // Cheapest rules first; restart from singles after any progress
+    // ------------------------------------------------------
+    while (!isComplete(state)) {
+        bool progress = false;
+
+        if (!assignNakedSingles(state, progress, rules)) {
+            return false;
+        }
+        if (progress) {
+            continue;
+        }
+
+        if (!assignHiddenSingles(state, progress, rules)) {
+            return false;
+        }
+        if (progress) {
+            continue;
+        }
+
+        if (!eliminateCageCombinations(state, progress, rules)) {
+            return false;
+        }
+        if (progress) {
+            continue;
+        }
+
+        if (!eliminateLockedCandidates(state, rules)) {
+            break;
+        }
+    }
+
+    // ------------------------------------------------------
+    // A complete grid must still meet every cage sum (no-op on
+    // rules without cages)
+    // ------------------------------------------------------
+    bool progress = false;
+    return eliminateCageCombinations(state, progress, rules);
+}
+
+template <typename Rules, typename Exhausted>
+constexpr int SudokuBitboardSolver::searchState(SudokuBitboardState& state, int maxCount, SudokuBitboardState* solution,
+                                                const Rules& rules, SudokuSearchStats& stats, Exhausted exhausted)
+{
+    if (exhausted(stats.nodes)) {
+        return 0;
+    }
+
+    stats.nodes++;
+
+    if (!propagate(state, rules)) {
+        return 0;
+    }
+
+    if (isComplete(state)) {
+        if (solution != nullptr) {
+            *solution = state;
+        }
+        return 1;
+    }
+
+    // ------------------------------------------------------
+    // Branch on the cell with the fewest candidates; the last
+    // candidate reuses this frame's state instead of a copy
+    // ------------------------------------------------------
+    int cell = chooseBranchCell(state);
+    int solutionCount = 0;
+
+    int digits[SUDOKU_SIZE] = {};
+    int digitCount = 0;
+
+    for (int digit = 0; digit < SUDOKU_SIZE; ++digit) {
+        if (state.candidates[digit].test(cell)) {
+            digits[digitCount++] = digit;
+        }
+    }
+
+    stats.branches++;
+
+    for (int i = 0; i < digitCount; ++i) {
+        if (i == digitCount - 1) {
+            assign(state, cell, digits[i], rules);
+            return solutionCount + searchState(state, maxCount - solutionCount, solution, rules, stats, exhausted);
+        }
+
+        SudokuBitboardState next = state;
+        assign(next, cell, digits[i], rules);
+        solutionCount += searchState(next, maxCount - solutionCount, solution, rules, stats, exhausted);
+
+        if (solutionCount >= maxCount) {
+            return solutionCount;
+        }
+    }
+
+    return solutionCount;
+}
+
+template <typename Rules>
+constexpr bool SudokuBitboardSolver::assignNakedSingles(SudokuBitboardState& state, bool& progress, const Rules& rules)
+{
+    // ------------------------------------------------------
+    // Bit-sliced count over the nine planes: cells seen in at least
+    // one plane and in at least two, for all 81 cells at once
+    // ------------------------------------------------------
+    SudokuBitboard once{0, 0};
+    SudokuBitboard twice{0, 0};
+
+    for (const auto& plane : state.candidates) {
+        twice |= once & plane;
+        once |= plane;
+    }
+
+    SudokuBitboard unsolved = andNot(SUDOKU_BITBOARDS.all, state.solved);
+
+    if (andNot(unsolved, once).any()) {
+        return false;
+    }
+
+    SudokuBitboard singles = andNot(once, twice) & unsolved;
+    if (singles.none()) {
+        return true;
+    }
+
+    progress = true;
+
+    // ------------------------------------------------------
+    // An earlier single may have taken a later one's last candidate
+    // ------------------------------------------------------
+    bool consistent = true;
+
+    singles.forEachCell([&state, &consistent, &rules](int cell) {
+        if (!consistent) {
+            return;
+        }
+
+        for (int digit = 0; digit < SUDOKU_SIZE; ++digit) {
+            if (state.candidates[digit].test(cell)) {
+                assign(state, cell, digit, rules);
+                return;
+            }
+        }
+        consistent = false;
+    });
+
+    return consistent;
+}
+
+template <typename Rules>
+constexpr bool SudokuBitboardSolver::assignHiddenSingles(SudokuBitboardState& state, bool& progress, const Rules& rules)
+{
+    const SudokuRuleTables& tables = rules.tables();
+
+    for (int digit = 0; digit < SUDOKU_SIZE; ++digit) {
+        // ------------------------------------------------------
+        // Units already holding the digit need no check
+        // ------------------------------------------------------
+        uint64_t openUnits = (uint64_t(1) << rules.unitCount()) - 1;
+
+        (state.candidates[digit] & state.solved).forEachCell([&openUnits, &tables](int cell) {
+            openUnits &= ~tables.cellUnits[cell];
+        });
+
+        for (; openUnits != 0; openUnits &= openUnits - 1) {
+            int unit = bitboardLowestBit(openUnits);
+            SudokuBitboard places = state.candidates[digit] & tables.units[unit];
+
+            if (places.none()) {
+                return false;
+            }
+
+            if (places.isSingleCell()) {
+                assign(state, places.lowestCell(), digit, rules);
+                progress = true;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename Rules>
+constexpr bool SudokuBitboardSolver::eliminateCageCombinations(SudokuBitboardState& state, bool& progress, const Rules& rules)
+{
+    // ------------------------------------------------------
+    // The empty cells of a cage must complete one of the digit
+    // combinations for the rest of its sum: digits that no such
+    // combination uses leave the cage, and no combination at all
+    // is a dead end. One table lookup per cage.
+    // ------------------------------------------------------
+    const SudokuRuleTables& tables = rules.tables();
+
+    for (int cage = 0; cage < rules.cageCount(); ++cage) {
+        const SudokuRuleCage& rule = tables.cages[cage];
+        SudokuBitboard open = andNot(rule.cells, state.solved);
+        int remaining = rule.sum;
+
+        (rule.cells & state.solved).forEachCell([&state, &remaining](int cell) {
+            remaining -= state.values[cell];
+        });
+
+        if (open.none()) {
+            if (remaining != 0) {
+                return false;
+            }
+            continue;
+        }
+
+        // Placed cage digits have already left the open cells as peers
+        uint16_t allowed = 0;
+        for (int digit = 0; digit < SUDOKU_SIZE; ++digit) {
+            if ((state.candidates[digit] & open).any()) {
+                allowed |= static_cast<uint16_t>(1u << digit);
+            }
+        }
+
+        uint16_t legal = cageCombinationDigits(open.count(), remaining, allowed);
+        if (legal == 0) {
+            return false;
+        }
+
+        for (uint16_t dropped = allowed & ~legal; dropped != 0; dropped &= dropped - 1) {
+            int digit = bitboardLowestBit(dropped);
+            state.candidates[digit] = andNot(state.candidates[digit], open);
+            progress = true;
+        }
+    }
+    return true;
+}
+
+template <typename Rules>
+constexpr bool SudokuBitboardSolver::eliminateLockedCandidates(SudokuBitboardState& state, const Rules& rules)
+{
+    // ------------------------------------------------------
+    // Pointing: a digit confined to one line within a box leaves the
+    // rest of the line. Claiming: confined to one box within a line,
+    // it leaves the rest of the box. Any two overlapping units of a
+    // variant (a diagonal and a box, a window and a row) work alike.
+    // ------------------------------------------------------
+    const SudokuRuleTables& tables = rules.tables();
+    bool changed = false;
+
+    for (auto& plane : state.candidates) {
+        // Only unfilled cells matter; a placed digit has no peers left in the plane
+        SudokuBitboard open = andNot(plane, state.solved);
+
+        if (open.none()) {
+            continue;
+        }
+
+        for (int i = 0; i < rules.intersectionCount(); ++i) {
+            const SudokuRuleIntersection& intersection = tables.intersections[i];
+            const SudokuBitboard& shared = intersection.shared;
+
+            if ((open & shared).none()) {
+                continue;
+            }
+
+            SudokuBitboard firstRest = andNot(open & tables.units[intersection.first], shared);
+            SudokuBitboard secondRest = andNot(open & tables.units[intersection.second], shared);
+
+            if (firstRest.none() && secondRest.any()) {
+                open = andNot(open, secondRest);
+                changed = true;
+            } else if (secondRest.none() && firstRest.any()) {
+                open = andNot(open, firstRest);
+                changed = true;
+            }
+        }
+
+        plane = open | (plane & state.solved);
+    }
+    return changed;
+}
+
+constexpr int SudokuBitboardSolver::chooseBranchCell(const SudokuBitboardState& state)
+{
+    // ------------------------------------------------------
+    // Bivalue cells are the common minimum; find them bit-sliced
+    // ------------------------------------------------------
+    SudokuBitboard once{0, 0};
+    SudokuBitboard twice{0, 0};
+    SudokuBitboard thrice{0, 0};
+
+    for (const auto& plane : state.candidates) {
+        thrice |= twice & plane;
+        twice |= once & plane;
+        once |= plane;
+    }
+
+    SudokuBitboard unsolved = andNot(SUDOKU_BITBOARDS.all, state.solved);
+    SudokuBitboard bivalue = andNot(twice, thrice) & unsolved;
+
+    if (bivalue.any()) {
+        return bivalue.lowestCell();
+    }
+
+    // ------------------------------------------------------
+    // Otherwise scan the unsolved cells for the smallest count
+    // ------------------------------------------------------
+    int bestCell = unsolved.lowestCell();
+    int bestCount = SUDOKU_SIZE + 1;
+
+    unsolved.forEachCell([&state, &bestCell, &bestCount](int cell) {
+        int count = 0;
+        for (const auto& plane : state.candidates) {
+            count += plane.test(cell) ? 1 : 0;
+        }
+        if (count < bestCount) {
+            bestCount = count;
+            bestCell = cell;
+        }
+    });
+
+    return bestCell;
+}
@@ -12,34 +12,110 @@
  */
 
 #include "SudokuBoard.hpp"
+#include "SudokuBitboard.hpp"
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <iomanip>
+#include <cstdint>
+
+// =================================================
+// Live Conflict Tracking State
+// =================================================
+
+struct SudokuBoard::ConflictTracker
+{
+    std::array<std::array<uint8_t, SUDOKU_SIZE + 1>, SUDOKU_UNITS> unitCounts{};  // Digit counts per unit
+    std::array<bool, SUDOKU_CELLS> conflicts{};          // Cells clashing with a peer
+    int conflictCount = 0;
+    std::array<SudokuBitboard, SUDOKU_SIZE + 1> digitCells{};   // Cells holding each digit (0 = empty)
+};
+
+static_assert(sizeof(SudokuBoard) <= 3 * 64, "SudokuBoard should fit in three cache lines");
+
+static int popCount(uint16_t mask)
+{
+    int count = 0;
+    while (mask != 0) {
+        mask &= static_cast<uint16_t>(mask - 1);
+        ++count;
+    }
+    return count;
+}
 
 // =================================================
 // Constructor & Destructor
 // =================================================
 
 SudokuBoard::SudokuBoard()
-    : m_board{}
-    , m_fixedCells{}
+    : m_fixedBits{}
+    , m_dirtyBits{}
+    , m_cells{}
+    , m_filledCount(0)
+    , m_unitMasks{}
+    , m_generation(0)
+    , m_hash(0)
+    , m_tracker()
 {
-    // ------------------------------------------------------
-    // Initialize all cells to empty and not fixed
-    // ------------------------------------------------------
-    for (int row = 0; row < SUDOKU_SIZE; ++row) {
-        for (int col = 0; col < SUDOKU_SIZE; ++col) {
-            m_board[row][col] = 0;
-            m_fixedCells[row][col] = false;
-        }
-    }
 }
 
 SudokuBoard::~SudokuBoard()
 {
 }
 
+SudokuBoard::SudokuBoard(const SudokuBoard& other)
+    : m_fixedBits(other.m_fixedBits)
+    , m_dirtyBits(other.m_dirtyBits)
+    , m_cells(other.m_cells)
+    , m_filledCount(other.m_filledCount)
+    , m_unitMasks(other.m_unitMasks)
+    , m_generation(other.m_generation)
+    , m_hash(other.m_hash)
+    , m_tracker(other.m_tracker ? std::make_unique<ConflictTracker>(*other.m_tracker) : nullptr)
+{
+}
+
+// ------------------------------------------------------
+// Assignment keeps this board's change history and marks the
+// cells whose value, fixed mark or conflict state differ
+// ------------------------------------------------------
+SudokuBoard& SudokuBoard::operator=(const SudokuBoard& other)
+{
+    if (this != &other) {
+        markDirtyBits(differenceBits(other));
+
+        m_fixedBits = other.m_fixedBits;
+        m_cells = other.m_cells;
+        m_filledCount = other.m_filledCount;
+        m_unitMasks = other.m_unitMasks;
+        m_hash = other.m_hash;
+        m_tracker = other.m_tracker ? std::make_unique<ConflictTracker>(*other.m_tracker) : nullptr;
+    }
+    return *this;
+}
+
+SudokuBoard::SudokuBoard(SudokuBoard&& other) noexcept = default;
+
+SudokuBoard& SudokuBoard::operator=(SudokuBoard&& other) noexcept
+{
+    if (this != &other) {
+        markDirtyBits(differenceBits(other));
+
+        m_fixedBits = other.m_fixedBits;
+        m_cells = other.m_cells;
+        m_filledCount = other.m_filledCount;
+        m_unitMasks = other.m_unitMasks;
+        m_hash = other.m_hash;
+        m_tracker = std::move(other.m_tracker);
+    }
+    return *this;
+}
+
+bool SudokuBoard::operator==(const SudokuBoard& other) const
+{
+    return m_cells == other.m_cells && m_fixedBits == other.m_fixedBits;
+}
+
 // =================================================
 // Board Access Methods
 // =================================================
@@ -49,7 +125,7 @@ int SudokuBoard::getValue(int row, int col) const
     if (!isValidIndex(row, col)) {
         return -1;
     }
-    return m_board[row][col];
+    return m_cells[row * SUDOKU_SIZE + col];
 }
 
 void SudokuBoard::setValue(int row, int col, int value)
@@ -60,27 +136,32 @@ void SudokuBoard::setValue(int row, int col, int value)
     if (!isValidIndex(row, col)) {
         return;
     }
-    
+
     if (value < 0 || value > 9) {
         return;
     }
-    
+
     // ------------------------------------------------------
     // Don't allow modifying fixed cells
     // ------------------------------------------------------
-    if (m_fixedCells[row][col]) {
+    int cell = row * SUDOKU_SIZE + col;
+    if (isFixedCell(cell)) {
         return;
     }
-    
-    m_board[row][col] = value;
+
+    writeCell(cell, value);
 }
 
 void SudokuBoard::clearValue(int row, int col)
 {
-    if (!isValidIndex(row, col) || m_fixedCells[row][col]) {
+    if (!isValidIndex(row, col)) {
         return;
     }
-    m_board[row][col] = 0;
+
+    int cell = row * SUDOKU_SIZE + col;
+    if (!isFixedCell(cell)) {
+        writeCell(cell, 0);
+    }
 }
 
 bool SudokuBoard::isEmpty(int row, int col) const
@@ -88,7 +169,7 @@ bool SudokuBoard::isEmpty(int row, int col) const
     if (!isValidIndex(row, col)) {
         return false;
     }
-    return m_board[row][col] == 0;
+    return m_cells[row * SUDOKU_SIZE + col] == 0;
 }
 
 // =================================================
@@ -98,11 +179,13 @@ bool SudokuBoard::isEmpty(int row, int col) const
 bool SudokuBoard::isValidPlacement(int row, int col, int value) const
 {
     // ------------------------------------------------------
-    // Check row, column, and 3x3 box constraints
+    // Check row, column, and 3x3 box constraints with one mask test
     // ------------------------------------------------------
-    return isValidRow(row, value) && 
-           isValidCol(col, value) && 
-           isValidBox(row, col, value);
+    if (!isValidIndex(row, col) || value < 1 || value > SUDOKU_SIZE) {
+        return false;
+    }
+
+    return (getCandidateMask(row, col) & (1u << value)) != 0;
 }
 
 bool SudokuBoard::isValidRow(int row, int value) const
@@ -110,13 +193,8 @@ bool SudokuBoard::isValidRow(int row, int value) const
     if (row < 0 || row >= SUDOKU_SIZE || value < 1 || value > SUDOKU_SIZE) {
         return false;
     }
-    
-    for (int col = 0; col < SUDOKU_SIZE; ++col) {
-        if (m_board[row][col] == value) {
-            return false;
-        }
-    }
-    return true;
+
+    return (m_unitMasks[ROW_UNIT_BASE + row] & (1u << value)) == 0;
 }
 
 bool SudokuBoard::isValidCol(int col, int value) const
@@ -124,13 +202,8 @@ bool SudokuBoard::isValidCol(int col, int value) const
     if (col < 0 || col >= SUDOKU_SIZE || value < 1 || value > SUDOKU_SIZE) {
         return false;
     }
-    
-    for (int row = 0; row < SUDOKU_SIZE; ++row) {
-        if (m_board[row][col] == value) {
-            return false;
-        }
-    }
-    return true;
+
+    return (m_unitMasks[COL_UNIT_BASE + col] & (1u << value)) == 0;
 }
 
 bool SudokuBoard::isValidBox(int row, int col, int value) const
@@ -138,42 +211,78 @@ bool SudokuBoard::isValidBox(int row, int col, int value) const
     if (!isValidIndex(row, col) || value < 1 || value > 9) {
         return false;
     }
-    
-    int boxRow = (row / 3) * 3;
-    int boxCol = (col / 3) * 3;
-    
-    for (int r = boxRow; r < boxRow + 3; ++r) {
-        for (int c = boxCol; c < boxCol + 3; ++c) {
-            if (m_board[r][c] == value) {
-                return false;
-            }
-        }
-    }
-    return true;
+
+    int box = SUDOKU_TABLES.cellBox[row * SUDOKU_SIZE + col];
+    return (m_unitMasks[BOX_UNIT_BASE + box] & (1u << value)) == 0;
 }
 
 bool SudokuBoard::isBoardValid() const
 {
     // ------------------------------------------------------
-    // Check if current board state is valid (no conflicts)
+    // Without duplicates every filled cell adds one distinct digit to
+    // each of its three units, so the mask popcounts must add up
     // ------------------------------------------------------
-    for (int row = 0; row < SUDOKU_SIZE; ++row) {
-        for (int col = 0; col < SUDOKU_SIZE; ++col) {
-            int value = m_board[row][col];
-            
-            if (value != 0) {
-                // Temporarily clear cell to check if value is valid
-                const_cast<SudokuBoard*>(this)->m_board[row][col] = 0;
-                bool valid = isValidPlacement(row, col, value);
-                const_cast<SudokuBoard*>(this)->m_board[row][col] = value;
-                
-                if (!valid) {
-                    return false;
-                }
-            }
+    int distinct = 0;
+
+    for (uint16_t mask : m_unitMasks) {
+        distinct += popCount(mask);
+    }
+
+    return distinct == 3 * m_filledCount;
+}
+
+SudokuValidation SudokuBoard::validate() const
+{
+    SudokuValidation result;
+
+    // ------------------------------------------------------
+    // Build per-unit masks of seen and duplicated digits
+    // ------------------------------------------------------
+    std::array<uint16_t, SUDOKU_UNITS> seen{};
+    std::array<uint16_t, SUDOKU_UNITS> duplicated{};
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        int value = m_cells[cell];
+
+        if (value == 0) {
+            continue;
+        }
+
+        uint16_t bit = static_cast<uint16_t>(1u << value);
+
+        for (uint8_t unit : SUDOKU_TABLES.cellUnits[cell]) {
+            duplicated[unit] |= seen[unit] & bit;
+            seen[unit] |= bit;
         }
     }
-    return true;
+
+    for (int unit = 0; unit < SUDOKU_UNITS; ++unit) {
+        if (duplicated[unit] != 0) {
+            result.conflictingUnits.push_back(unit);
+        }
+    }
+
+    // ------------------------------------------------------
+    // A filled cell conflicts if any of its units duplicates its digit
+    // ------------------------------------------------------
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        int value = m_cells[cell];
+
+        if (value == 0) {
+            continue;
+        }
+
+        uint16_t bit = static_cast<uint16_t>(1u << value);
+        const auto& units = SUDOKU_TABLES.cellUnits[cell];
+        uint16_t clashes = duplicated[units[0]] | duplicated[units[1]] | duplicated[units[2]];
+
+        if (clashes & bit) {
+            result.conflictingCells.push_back({SUDOKU_TABLES.cellRow[cell], SUDOKU_TABLES.cellCol[cell]});
+        }
+    }
+
+    result.valid = result.conflictingCells.empty();
+    return result;
 }
 
 bool SudokuBoard::isSolved() const
@@ -181,15 +290,33 @@ bool SudokuBoard::isSolved() const
     // ------------------------------------------------------
     // Check if board is completely filled and valid
     // ------------------------------------------------------
-    for (int row = 0; row < SUDOKU_SIZE; ++row) {
-        for (int col = 0; col < SUDOKU_SIZE; ++col) {
-            if (m_board[row][col] == 0) {
-                return false;
-            }
-        }
+    return m_filledCount == SUDOKU_CELLS && isBoardValid();
+}
+
+// =================================================
+// Unit Masks
+// =================================================
+
+uint16_t SudokuBoard::getUnitMask(int unit) const
+{
+    if (unit < 0 || unit >= SUDOKU_UNITS) {
+        return 0;
     }
-    
-    return isBoardValid();
+    return m_unitMasks[unit];
+}
+
+uint16_t SudokuBoard::getCandidateMask(int row, int col) const
+{
+    // ------------------------------------------------------
+    // Digits (bits 1-9) absent from all three units of the cell
+    // ------------------------------------------------------
+    if (!isValidIndex(row, col)) {
+        return 0;
+    }
+
+    const auto& units = SUDOKU_TABLES.cellUnits[row * SUDOKU_SIZE + col];
+    uint16_t used = m_unitMasks[units[0]] | m_unitMasks[units[1]] | m_unitMasks[units[2]];
+    return static_cast<uint16_t>(~used & 0x3FE);
 }
 
 // =================================================
@@ -198,29 +325,64 @@ bool SudokuBoard::isSolved() const
 
 void SudokuBoard::clearBoard()
 {
-    for (int row = 0; row < SUDOKU_SIZE; ++row) {
-        for (int col = 0; col < SUDOKU_SIZE; ++col) {
-            if (!m_fixedCells[row][col]) {
-                m_board[row][col] = 0;
-            }
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        if (!isFixedCell(cell)) {
+            writeCell(cell, 0);
         }
     }
 }
 
 void SudokuBoard::copyBoard(const SudokuBoard& other)
 {
-    m_board = other.m_board;
-    m_fixedCells = other.m_fixedCells;
+    markDirtyBits(differenceBits(other));
+
+    m_fixedBits = other.m_fixedBits;
+    m_cells = other.m_cells;
+    m_filledCount = other.m_filledCount;
+    m_unitMasks = other.m_unitMasks;
+    m_hash = other.m_hash;
+
+    if (m_tracker) {
+        rebuildConflictTracking();
+    }
 }
 
 SudokuGrid SudokuBoard::getBoard() const
 {
-    return m_board;
+    SudokuGrid grid{};
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        grid[SUDOKU_TABLES.cellRow[cell]][SUDOKU_TABLES.cellCol[cell]] = m_cells[cell];
+    }
+    return grid;
 }
 
 void SudokuBoard::setBoard(const SudokuGrid& board)
 {
-    m_board = board;
+    // ------------------------------------------------------
+    // Values outside 0-9 cannot be stored and are treated as empty
+    // ------------------------------------------------------
+    std::array<uint64_t, 2> changed{};
+    m_filledCount = 0;
+    m_hash = 0;
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        int value = board[SUDOKU_TABLES.cellRow[cell]][SUDOKU_TABLES.cellCol[cell]];
+        uint8_t stored = static_cast<uint8_t>(value >= 1 && value <= SUDOKU_SIZE ? value : 0);
+        if (stored != m_cells[cell]) {
+            changed[cell / 64] |= uint64_t(1) << (cell % 64);
+        }
+        m_cells[cell] = stored;
+        m_filledCount += stored != 0;
+        m_hash ^= SUDOKU_ZOBRIST[cell][stored];
+    }
+
+    markDirtyBits(changed);
+    rebuildUnitMasks();
+
+    if (m_tracker) {
+        rebuildConflictTracking();
+    }
 }
 
 // ------------------------------------------------------
@@ -236,7 +398,7 @@ SudokuLine SudokuBoard::getRow(int row) const
     }
 
     for (int col = 0; col < SUDOKU_SIZE; ++col) {
-        result[col] = m_board[row][col];
+        result[col] = m_cells[row * SUDOKU_SIZE + col];
     }
 
     return result;
@@ -251,7 +413,7 @@ SudokuLine SudokuBoard::getColumn(int col) const
     }
 
     for (int row = 0; row < SUDOKU_SIZE; ++row) {
-        result[row] = m_board[row][col];
+        result[row] = m_cells[row * SUDOKU_SIZE + col];
     }
 
     return result;
@@ -264,20 +426,13 @@ SudokuBox SudokuBoard::getBox(int boxRow, int boxCol) const
     // ------------------------------------------------------
     // boxRow and boxCol are box indices in [0..2]
     // ------------------------------------------------------
-    int startRow = boxRow * 3;
-    int startCol = boxCol * 3;
-
-    if (!isValidIndex(startRow, startCol)) {
+    if (boxRow < 0 || boxRow >= 3 || boxCol < 0 || boxCol >= 3) {
         return result;
     }
 
-    int index = 0;
-    for (int r = startRow; r < startRow + 3; ++r) {
-        for (int c = startCol; c < startCol + 3; ++c) {
-            if (index < SUDOKU_SIZE) {
-                result[index++] = m_board[r][c];
-            }
-        }
+    const auto& cells = SUDOKU_TABLES.unitCells[BOX_UNIT_BASE + boxRow * 3 + boxCol];
+    for (int i = 0; i < SUDOKU_UNIT_SIZE; ++i) {
+        result[i] = m_cells[cells[i]];
     }
 
     return result;
@@ -290,7 +445,7 @@ SudokuBox SudokuBoard::getBox(int boxRow, int boxCol) const
 void SudokuBoard::markAsFixed(int row, int col)
 {
     if (isValidIndex(row, col)) {
-        m_fixedCells[row][col] = true;
+        setFixedCell(row * SUDOKU_SIZE + col, true);
     }
 }
 
@@ -299,16 +454,100 @@ bool SudokuBoard::isFixed(int row, int col) const
     if (!isValidIndex(row, col)) {
         return false;
     }
-    return m_fixedCells[row][col];
+    return isFixedCell(row * SUDOKU_SIZE + col);
 }
 
 void SudokuBoard::clearAllFixedMarks()
 {
-    for (int row = 0; row < SUDOKU_SIZE; ++row) {
-        for (int col = 0; col < SUDOKU_SIZE; ++col) {
-            m_fixedCells[row][col] = false;
+    markDirtyBits(m_fixedBits);
+    m_fixedBits = {0, 0};
+}
+
+// =================================================
+// Live Conflict Tracking
+// =================================================
+
+void SudokuBoard::setConflictTracking(bool enabled)
+{
+    if (enabled == isConflictTrackingEnabled()) {
+        return;
+    }
+
+    // ------------------------------------------------------
+    // Start from a clean slate; enabling reports every conflict as dirty
+    // ------------------------------------------------------
+    if (enabled) {
+        m_tracker = std::make_unique<ConflictTracker>();
+        rebuildConflictTracking();
+    } else {
+        for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+            if (m_tracker->conflicts[cell]) {
+                markDirty(cell);
+            }
+        }
+        m_tracker.reset();
+    }
+}
+
+bool SudokuBoard::hasConflict(int row, int col) const
+{
+    if (!m_tracker || !isValidIndex(row, col)) {
+        return false;
+    }
+    return m_tracker->conflicts[row * SUDOKU_SIZE + col];
+}
+
+int SudokuBoard::getConflictCount() const
+{
+    return m_tracker ? m_tracker->conflictCount : 0;
+}
+
+int SudokuBoard::getUnitDigitCount(int unit, int value) const
+{
+    if (!m_tracker || unit < 0 || unit >= SUDOKU_UNITS || value < 1 || value > SUDOKU_SIZE) {
+        return 0;
+    }
+    return m_tracker->unitCounts[unit][value];
+}
+
+SudokuBitboard SudokuBoard::getDigitCells(int value) const
+{
+    if (value < 1 || value > SUDOKU_SIZE) {
+        return SudokuBitboard{0, 0};
+    }
+    if (m_tracker) {
+        return m_tracker->digitCells[value];
+    }
+
+    // ------------------------------------------------------
+    // Without tracking there is no index; scan the cells
+    // ------------------------------------------------------
+    SudokuBitboard cells{0, 0};
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        if (m_cells[cell] == value) {
+            cells |= SUDOKU_BITBOARDS.cells[cell];
+        }
+    }
+    return cells;
+}
+
+// =================================================
+// Change Tracking
+// =================================================
+
+std::vector<std::pair<int, int>> SudokuBoard::takeDirtyCells()
+{
+    std::vector<std::pair<int, int>> dirty;
+
+    for (int word = 0; word < 2; ++word) {
+        for (uint64_t bits = m_dirtyBits[word]; bits != 0; bits &= bits - 1) {
+            int cell = word * 64 + bitboardLowestBit(bits);
+            dirty.push_back({SUDOKU_TABLES.cellRow[cell], SUDOKU_TABLES.cellCol[cell]});
         }
     }
+
+    m_dirtyBits = {0, 0};
+    return dirty;
 }
 
 // =================================================
@@ -321,32 +560,37 @@ bool SudokuBoard::loadFromFile(const std::string& filename)
     if (!file.is_open()) {
         return false;
     }
-    
+
     // ------------------------------------------------------
     // Read 9x9 grid from file
     // Format: 0 = empty, 1-9 = user cell, -1 to -9 = fixed cell
     // ------------------------------------------------------
-    clearAllFixedMarks();
-    
+    SudokuGrid grid{};
+    std::array<uint64_t, 2> fixedBits{};
+
     for (int row = 0; row < SUDOKU_SIZE; ++row) {
         for (int col = 0; col < SUDOKU_SIZE; ++col) {
             int value;
-            if (!(file >> value)) {
+            if (!(file >> value) || value < -SUDOKU_SIZE || value > SUDOKU_SIZE) {
                 return false;
             }
-            
+
             // Negative values indicate fixed cells
             if (value < 0) {
-                m_board[row][col] = -value;
-                m_fixedCells[row][col] = true;
+                int cell = row * SUDOKU_SIZE + col;
+                grid[row][col] = -value;
+                fixedBits[cell / 64] |= uint64_t(1) << (cell % 64);
             } else {
-                m_board[row][col] = value;
-                m_fixedCells[row][col] = false;
+                grid[row][col] = value;
             }
         }
     }
-    
+
     file.close();
+
+    markDirtyBits({m_fixedBits[0] ^ fixedBits[0], m_fixedBits[1] ^ fixedBits[1]});
+    m_fixedBits = fixedBits;
+    setBoard(grid);
     return true;
 }
 
@@ -356,29 +600,30 @@ bool SudokuBoard::saveToFile(const std::string& filename) const
     if (!file.is_open()) {
         return false;
     }
-    
+
     // ------------------------------------------------------
     // Write 9x9 grid to file
     // Format: 0 = empty, 1-9 = user cell, -1 to -9 = fixed cell
     // ------------------------------------------------------
     for (int row = 0; row < SUDOKU_SIZE; ++row) {
         for (int col = 0; col < SUDOKU_SIZE; ++col) {
-            int value = m_board[row][col];
-            
+            int cell = row * SUDOKU_SIZE + col;
+            int value = m_cells[cell];
+
             // Write negative value if cell is fixed
-            if (m_fixedCells[row][col] && value != 0) {
+            if (isFixedCell(cell) && value != 0) {
                 file << -value;
             } else {
                 file << value;
             }
-            
+
             if (col < SUDOKU_SIZE - 1) {
                 file << " ";
             }
         }
         file << "\n";
     }
-    
+
     file.close();
     return true;
 }
@@ -390,32 +635,33 @@ bool SudokuBoard::saveToFile(const std::string& filename) const
 std::string SudokuBoard::toString() const
 {
     std::ostringstream oss;
-    
+
     oss << "-------------------------------------\n";
 
     for (int row = 0; row < SUDOKU_SIZE; ++row) {
         for (int col = 0; col < SUDOKU_SIZE; ++col) {
-            if (m_board[row][col] == 0) {
+            int value = m_cells[row * SUDOKU_SIZE + col];
+            if (value == 0) {
                 oss << ". ";
             } else {
-                oss << m_board[row][col] << " ";
+                oss << value << " ";
             }
-            
+
             // Add vertical separators for 3x3 boxes
             if ((col + 1) % 3 == 0 && col < SUDOKU_SIZE - 1) {
                 oss << "| ";
             }
         }
         oss << "\n";
-        
+
         // Add horizontal separators for 3x3 boxes
         if ((row + 1) % 3 == 0 && row < SUDOKU_SIZE - 1) {
             oss << "-------------------------------------\n";
         }
     }
-    
+
     oss << "-------------------------------------\n";
-    
+
     return oss.str();
 }
 
@@ -432,3 +678,174 @@ bool SudokuBoard::isValidIndex(int row, int col) const
 {
     return row >= 0 && row < SUDOKU_SIZE && col >= 0 && col < SUDOKU_SIZE;
 }
+
+bool SudokuBoard::isFixedCell(int cell) const
+{
+    return (m_fixedBits[cell / 64] >> (cell % 64)) & 1u;
+}
+
+void SudokuBoard::setFixedCell(int cell, bool fixed)
+{
+    uint64_t bit = uint64_t(1) << (cell % 64);
+    if (isFixedCell(cell) != fixed) {
+        markDirty(cell);
+    }
+
+    if (fixed) {
+        m_fixedBits[cell / 64] |= bit;
+    } else {
+        m_fixedBits[cell / 64] &= ~bit;
+    }
+}
+
+void SudokuBoard::writeCell(int cell, int value)
+{
+    int oldValue = m_cells[cell];
+    if (oldValue == value) {
+        return;
+    }
+
+    m_cells[cell] = static_cast<uint8_t>(value);
+    m_filledCount += (value != 0) - (oldValue != 0);
+    m_hash ^= SUDOKU_ZOBRIST[cell][oldValue] ^ SUDOKU_ZOBRIST[cell][value];
+    markDirty(cell);
+
+    // ------------------------------------------------------
+    // Adding a digit only sets bits; removing one needs the three
+    // units rescanned, since a duplicate may still hold the digit
+    // ------------------------------------------------------
+    const auto& units = SUDOKU_TABLES.cellUnits[cell];
+
+    if (oldValue == 0) {
+        uint16_t bit = static_cast<uint16_t>(1u << value);
+        m_unitMasks[units[0]] |= bit;
+        m_unitMasks[units[1]] |= bit;
+        m_unitMasks[units[2]] |= bit;
+    } else {
+        for (uint8_t unit : units) {
+            uint16_t mask = 0;
+            for (uint8_t member : SUDOKU_TABLES.unitCells[unit]) {
+                mask |= static_cast<uint16_t>(1u << m_cells[member]);
+            }
+            m_unitMasks[unit] = static_cast<uint16_t>(mask & 0x3FE);
+        }
+    }
+
+    if (!m_tracker) {
+        return;
+    }
+
+    // ------------------------------------------------------
+    // Update the digit index and the digit counts of the
+    // cell's three units
+    // ------------------------------------------------------
+    const SudokuBitboard& cellBit = SUDOKU_BITBOARDS.cells[cell];
+    m_tracker->digitCells[oldValue] = andNot(m_tracker->digitCells[oldValue], cellBit);
+    m_tracker->digitCells[value] |= cellBit;
+
+    for (uint8_t unit : units) {
+        if (oldValue != 0) {
+            --m_tracker->unitCounts[unit][oldValue];
+        }
+        if (value != 0) {
+            ++m_tracker->unitCounts[unit][value];
+        }
+    }
+
+    // ------------------------------------------------------
+    // Only the cell and peers holding the old or new digit can change state
+    // ------------------------------------------------------
+    refreshConflict(cell);
+
+    for (uint8_t peer : SUDOKU_TABLES.peers[cell]) {
+        int peerValue = m_cells[peer];
+        if (peerValue != 0 && (peerValue == oldValue || peerValue == value)) {
+            refreshConflict(peer);
+        }
+    }
+}
+
+void SudokuBoard::rebuildUnitMasks()
+{
+    m_unitMasks.fill(0);
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        uint16_t bit = static_cast<uint16_t>((1u << m_cells[cell]) & 0x3FE);
+        for (uint8_t unit : SUDOKU_TABLES.cellUnits[cell]) {
+            m_unitMasks[unit] |= bit;
+        }
+    }
+}
+
+void SudokuBoard::rebuildConflictTracking()
+{
+    for (auto& counts : m_tracker->unitCounts) {
+        counts.fill(0);
+    }
+    m_tracker->digitCells.fill(SudokuBitboard{0, 0});
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        int value = m_cells[cell];
+        m_tracker->digitCells[value] |= SUDOKU_BITBOARDS.cells[cell];
+
+        if (value != 0) {
+            for (uint8_t unit : SUDOKU_TABLES.cellUnits[cell]) {
+                ++m_tracker->unitCounts[unit][value];
+            }
+        }
+    }
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        refreshConflict(cell);
+    }
+}
+
+void SudokuBoard::refreshConflict(int cell)
+{
+    int value = m_cells[cell];
+    bool conflict = false;
+
+    if (value != 0) {
+        for (uint8_t unit : SUDOKU_TABLES.cellUnits[cell]) {
+            conflict = conflict || m_tracker->unitCounts[unit][value] > 1;
+        }
+    }
+
+    if (conflict == m_tracker->conflicts[cell]) {
+        return;
+    }
+
+    m_tracker->conflicts[cell] = conflict;
+    m_tracker->conflictCount += conflict ? 1 : -1;
+    markDirty(cell);
+}
+
+void SudokuBoard::markDirty(int cell)
+{
+    m_dirtyBits[cell / 64] |= uint64_t(1) << (cell % 64);
+    ++m_generation;
+}
+
+void SudokuBoard::markDirtyBits(const std::array<uint64_t, 2>& bits)
+{
+    if ((bits[0] | bits[1]) != 0) {
+        m_dirtyBits[0] |= bits[0];
+        m_dirtyBits[1] |= bits[1];
+        ++m_generation;
+    }
+}
+
+std::array<uint64_t, 2> SudokuBoard::differenceBits(const SudokuBoard& other) const
+{
+    std::array<uint64_t, 2> bits = {m_fixedBits[0] ^ other.m_fixedBits[0], m_fixedBits[1] ^ other.m_fixedBits[1]};
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        bool conflict = m_tracker && m_tracker->conflicts[cell];
+        bool otherConflict = other.m_tracker && other.m_tracker->conflicts[cell];
+
+        if (m_cells[cell] != other.m_cells[cell] || conflict != otherConflict) {
+            bits[cell / 64] |= uint64_t(1) << (cell % 64);
+        }
+    }
+    return bits;
+}
@@ -14,8 +14,14 @@
 
 #pragma once
 
+#include "SudokuBitboard.hpp"
+#include "SudokuTables.hpp"
 #include <array>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 // =================================================
 // Board configuration
@@ -28,6 +34,34 @@ using FixedGrid  = std::array<std::array<bool, SUDOKU_SIZE>, SUDOKU_SIZE>;
 using SudokuLine = std::array<int, SUDOKU_SIZE>;
 using SudokuBox  = std::array<int, SUDOKU_SIZE>;
 
+// =================================================
+// Validation Report
+// =================================================
+
+struct SudokuValidation
+{
+    bool valid = true;
+    std::vector<std::pair<int, int>> conflictingCells;   // Filled cells clashing with a peer
+    std::vector<int> conflictingUnits;                   // 0-8 rows, 9-17 columns, 18-26 boxes
+};
+
+// =================================================
+// SudokuBoard Class
+// =================================================
+//
+// Packed layout: one byte per cell, a 128-bit fixed-cell bitset and the
+// digit mask of every unit, so a board fits in three cache lines and
+// copies as plain memory. A Zobrist hash of the values is kept up to date
+// on every write. Live conflict tracking state (including the cells that
+// hold each digit) lives on the heap and only exists while tracking is
+// enabled.
+//
+// Every change a view can show (value, fixed mark, conflict state) sets
+// the cell's bit in a dirty bitset and bumps a generation counter, so a
+// view pushes only the cells that changed and can tell at a glance
+// whether anything did. Assigning or copying another board into this one
+// marks only the cells that differ.
+
 class SudokuBoard
 {
 public:
@@ -37,6 +71,14 @@ public:
     SudokuBoard();
     ~SudokuBoard();
     
+    SudokuBoard(const SudokuBoard& other);
+    SudokuBoard& operator=(const SudokuBoard& other);
+    SudokuBoard(SudokuBoard&& other) noexcept;
+    SudokuBoard& operator=(SudokuBoard&& other) noexcept;
+    
+    bool operator==(const SudokuBoard& other) const;
+    bool operator!=(const SudokuBoard& other) const { return !(*this == other); }
+    
     // ------------------------------------------------------
     // Board Access Methods
     // ------------------------------------------------------
@@ -44,6 +86,8 @@ public:
     void setValue(int row, int col, int value);
     void clearValue(int row, int col);
     bool isEmpty(int row, int col) const;
+    int getFilledCount() const { return m_filledCount; }
+    uint64_t getHash() const { return m_hash; }            // Zobrist hash of the values
     
     // ------------------------------------------------------
     // Validation Methods
@@ -53,8 +97,15 @@ public:
     bool isValidCol(int col, int value) const;
     bool isValidBox(int row, int col, int value) const;
     bool isBoardValid() const;
+    SudokuValidation validate() const;
     bool isSolved() const;
     
+    // ------------------------------------------------------
+    // Unit Masks (bit v set = digit v present)
+    // ------------------------------------------------------
+    uint16_t getUnitMask(int unit) const;
+    uint16_t getCandidateMask(int row, int col) const;
+    
     // ------------------------------------------------------
     // Board State Management
     // ------------------------------------------------------
@@ -77,6 +128,23 @@ public:
     bool isFixed(int row, int col) const;
     void clearAllFixedMarks();
     
+    // ------------------------------------------------------
+    // Live Conflict Tracking (optional)
+    // ------------------------------------------------------
+    void setConflictTracking(bool enabled);
+    bool isConflictTrackingEnabled() const { return m_tracker != nullptr; }
+    bool hasConflict(int row, int col) const;
+    int getConflictCount() const;
+    int getUnitDigitCount(int unit, int value) const;
+    SudokuBitboard getDigitCells(int value) const;          // Cells holding value
+    
+    // ------------------------------------------------------
+    // Change Tracking (for views)
+    // ------------------------------------------------------
+    uint32_t getGeneration() const { return m_generation; }   // Bumped on every visible change
+    bool hasDirtyCells() const { return (m_dirtyBits[0] | m_dirtyBits[1]) != 0; }
+    std::vector<std::pair<int, int>> takeDirtyCells();      // Changed since the last take
+    
     // ------------------------------------------------------
     // File I/O Methods
     // ------------------------------------------------------
@@ -90,14 +158,31 @@ public:
     void print() const;
 
 private:
+    struct ConflictTracker;
+    
     // ------------------------------------------------------
     // Private Data Members
     // ------------------------------------------------------
-    SudokuGrid m_board;   // 9x9 grid (0 = empty, 1-9 = filled)
-    FixedGrid  m_fixedCells;  // Track which cells are fixed
+    std::array<uint64_t, 2> m_fixedBits;                 // Bit per cell, row-major
+    std::array<uint64_t, 2> m_dirtyBits;                 // Cells changed since the last take
+    std::array<uint8_t, SUDOKU_CELLS> m_cells;           // 0 = empty, 1-9 = filled
+    uint8_t m_filledCount;                               // Non-empty cells
+    std::array<uint16_t, SUDOKU_UNITS> m_unitMasks;      // Digits present per unit
+    uint32_t m_generation;                               // Change counter
+    uint64_t m_hash;                                     // XOR of SUDOKU_ZOBRIST keys
+    std::unique_ptr<ConflictTracker> m_tracker;          // Null unless tracking is enabled
     
     // ------------------------------------------------------
     // Private Helper Methods
     // ------------------------------------------------------
     bool isValidIndex(int row, int col) const;
+    bool isFixedCell(int cell) const;
+    void setFixedCell(int cell, bool fixed);
+    void writeCell(int cell, int value);
+    void rebuildUnitMasks();
+    void rebuildConflictTracking();
+    void refreshConflict(int cell);
+    void markDirty(int cell);
+    void markDirtyBits(const std::array<uint64_t, 2>& bits);
+    std::array<uint64_t, 2> differenceBits(const SudokuBoard& other) const;
 };
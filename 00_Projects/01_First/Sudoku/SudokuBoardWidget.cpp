@@ -0,0 +1,372 @@
+/**
+ * @file SudokuBoardWidget.cpp
+ * @brief Implementation of the custom-painted board widget
+ *
+ * This file implements the cell state setters, the single-pass painting of
+ * cells, highlights, pencil marks and grid lines, and the mouse and
+ * keyboard handling of the board view.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#include "SudokuBoardWidget.hpp"
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <QPaintEvent>
+#include <QPainter>
+#include <QRegion>
+#include <QtMath>
+#include <algorithm>
+
+// =================================================
+// Constructor
+// =================================================
+
+SudokuBoardWidget::SudokuBoardWidget(QWidget *parent)
+    : QWidget(parent)
+    , m_values{}
+    , m_candidates{}
+    , m_matching{0, 0}
+    , m_selected(-1)
+    , m_pencilMarksVisible(false)
+    , m_cellBrush(QColor("#2d3436"))
+    , m_peerBrush(QColor("#3d4448"))
+    , m_matchBrush(QColor("#6c5ce7"))
+    , m_selectedBrush(QColor("#0984e3"))
+    , m_errorBrush(QColor("#d63031"))
+    , m_valueColor("#dfe6e9")
+    , m_givenColor("#74b9ff")
+    , m_brightColor("#ffffff")
+    , m_markColor("#7f8c8d")
+    , m_thinPen(QColor("#636e72"), 1)
+    , m_thickPen(QColor("#636e72"), 3)
+    , m_selectionPen(QColor("#74b9ff"), 2)
+{
+    setFocusPolicy(Qt::StrongFocus);
+    setAttribute(Qt::WA_OpaquePaintEvent);
+
+    m_valueFont = font();
+    m_valueFont.setPointSize(20);
+    m_valueFont.setBold(true);
+    m_markFont = QFont("Courier", 9);
+
+    for (int digit = 1; digit <= 9; ++digit) {
+        m_digitText[digit] = QString::number(digit);
+    }
+}
+
+// =================================================
+// Cell State
+// =================================================
+
+void SudokuBoardWidget::setCell(int row, int col, int value, bool initial)
+{
+    int cell = row * 9 + col;
+    uint8_t stored = static_cast<uint8_t>(value >= 1 && value <= 9 ? value : 0);
+
+    if (m_values[cell] != stored || m_fixed[cell] != initial) {
+        m_values[cell] = stored;
+        m_fixed[cell] = initial;
+        update(cellRect(cell).toAlignedRect());
+    }
+}
+
+void SudokuBoardWidget::setValue(int row, int col, int value)
+{
+    setCell(row, col, value, m_fixed[row * 9 + col]);
+}
+
+void SudokuBoardWidget::setError(int row, int col, bool error)
+{
+    int cell = row * 9 + col;
+    if (m_errors[cell] != error) {
+        m_errors[cell] = error;
+        update(cellRect(cell).toAlignedRect());
+    }
+}
+
+void SudokuBoardWidget::clearErrors()
+{
+    if (m_errors.any()) {
+        m_errors.reset();
+        update();
+    }
+}
+
+void SudokuBoardWidget::setCandidates(int row, int col, uint16_t candidates)
+{
+    int cell = row * 9 + col;
+    if (m_candidates[cell] != candidates) {
+        m_candidates[cell] = candidates;
+        update(cellRect(cell).toAlignedRect());
+    }
+}
+
+void SudokuBoardWidget::setPencilMarksVisible(bool visible)
+{
+    m_pencilMarksVisible = visible;
+    update();
+}
+
+// =================================================
+// Selection
+// =================================================
+
+void SudokuBoardWidget::selectCell(int row, int col)
+{
+    // ------------------------------------------------------
+    // Repaint the old and new selection with their peers only
+    // ------------------------------------------------------
+    SudokuBitboard changed = selectionArea();
+    m_selected = row * 9 + col;
+    updateCells(changed | selectionArea());
+    emit cellSelected(row, col);
+}
+
+void SudokuBoardWidget::clearSelection()
+{
+    updateCells(selectionArea());
+    m_selected = -1;
+    setMatchingCells(SudokuBitboard{0, 0});
+}
+
+void SudokuBoardWidget::setMatchingCells(const SudokuBitboard& cells)
+{
+    SudokuBitboard changed = m_matching ^ cells;
+    if (changed.any()) {
+        m_matching = cells;
+        updateCells(changed);
+    }
+}
+
+// =================================================
+// Painting
+// =================================================
+
+void SudokuBoardWidget::paintEvent(QPaintEvent *event)
+{
+    QPainter painter(this);
+    painter.fillRect(event->rect(), m_cellBrush);
+
+    // ------------------------------------------------------
+    // Highlights: the peers of the selection, and the cells the
+    // owner marked as holding the selected digit
+    // ------------------------------------------------------
+    const SudokuBitboard& peers = SUDOKU_BITBOARDS.peers[m_selected >= 0 ? m_selected : 0];
+    qreal size = cellSize();
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        QRectF rect = cellRect(cell);
+        if (!event->rect().intersects(rect.toAlignedRect())) {
+            continue;
+        }
+
+        bool peer = m_selected >= 0 && peers.test(cell);
+        bool matching = cell != m_selected && m_matching.test(cell);
+
+        const QBrush *background = &m_cellBrush;
+        const QColor *textColor = m_fixed[cell] ? &m_givenColor : &m_valueColor;
+
+        if (peer) {
+            background = &m_peerBrush;
+        }
+        if (matching) {
+            background = &m_matchBrush;
+            textColor = &m_brightColor;
+        }
+        if (cell == m_selected) {
+            background = &m_selectedBrush;
+        }
+        if (m_errors[cell]) {
+            background = &m_errorBrush;
+            textColor = &m_brightColor;
+        }
+
+        if (background != &m_cellBrush) {
+            painter.fillRect(rect, *background);
+        }
+
+        // ------------------------------------------------------
+        // Value, or the pencil marks of an empty cell
+        // ------------------------------------------------------
+        if (m_values[cell] != 0) {
+            painter.setFont(m_valueFont);
+            painter.setPen(*textColor);
+            painter.drawText(rect, Qt::AlignCenter, m_digitText[m_values[cell]]);
+        } else if (m_pencilMarksVisible && m_candidates[cell] != 0) {
+            painter.drawPixmap(rect.topLeft(), markTile(m_candidates[cell]));
+        }
+    }
+
+    // ------------------------------------------------------
+    // Grid lines: thin between cells, thick around boxes
+    // ------------------------------------------------------
+    qreal extent = size * 9;
+
+    painter.setPen(m_thinPen);
+    for (int line = 1; line < 9; ++line) {
+        if (line % 3 != 0) {
+            painter.drawLine(QPointF(line * size, 0), QPointF(line * size, extent));
+            painter.drawLine(QPointF(0, line * size), QPointF(extent, line * size));
+        }
+    }
+
+    painter.setPen(m_thickPen);
+    for (int line = 0; line <= 9; line += 3) {
+        qreal offset = std::clamp(line * size, qreal(1.5), extent - qreal(1.5));
+        painter.drawLine(QPointF(offset, 0), QPointF(offset, extent));
+        painter.drawLine(QPointF(0, offset), QPointF(extent, offset));
+    }
+
+    if (m_selected >= 0) {
+        painter.setPen(m_selectionPen);
+        painter.setBrush(Qt::NoBrush);
+        painter.drawRect(cellRect(m_selected).adjusted(2, 2, -2, -2));
+    }
+}
+
+// =================================================
+// Input Handling
+// =================================================
+
+void SudokuBoardWidget::mousePressEvent(QMouseEvent *event)
+{
+    int cell = cellAt(event->pos());
+    if (cell >= 0) {
+        setFocus(Qt::MouseFocusReason);
+        selectCell(cell / 9, cell % 9);
+    }
+}
+
+void SudokuBoardWidget::keyPressEvent(QKeyEvent *event)
+{
+    int key = event->key();
+
+    // ------------------------------------------------------
+    // Handle number keys (1-9) and delete keys
+    // ------------------------------------------------------
+    if (key >= Qt::Key_1 && key <= Qt::Key_9) {
+        enterValue(key - Qt::Key_0);
+        return;
+    }
+
+    if (key == Qt::Key_Backspace || key == Qt::Key_Delete || key == Qt::Key_0) {
+        enterValue(0);
+        return;
+    }
+
+    // ------------------------------------------------------
+    // Handle arrow key navigation
+    // ------------------------------------------------------
+    int rowStep = key == Qt::Key_Up ? -1 : (key == Qt::Key_Down ? 1 : 0);
+    int colStep = key == Qt::Key_Left ? -1 : (key == Qt::Key_Right ? 1 : 0);
+
+    if (rowStep != 0 || colStep != 0) {
+        int row = m_selected < 0 ? 0 : std::clamp(m_selected / 9 + rowStep, 0, 8);
+        int col = m_selected < 0 ? 0 : std::clamp(m_selected % 9 + colStep, 0, 8);
+        selectCell(row, col);
+        return;
+    }
+
+    QWidget::keyPressEvent(event);
+}
+
+void SudokuBoardWidget::enterValue(int value)
+{
+    // The owner applies the entry to its model and pushes it back
+    if (m_selected < 0 || m_fixed[m_selected] || m_values[m_selected] == value) {
+        return;
+    }
+
+    emit cellValueChanged(m_selected / 9, m_selected % 9, value);
+}
+
+// =================================================
+// Private Helper Methods
+// =================================================
+
+qreal SudokuBoardWidget::cellSize() const
+{
+    return std::min(width(), height()) / 9.0;
+}
+
+QRectF SudokuBoardWidget::cellRect(int cell) const
+{
+    qreal size = cellSize();
+    return QRectF((cell % 9) * size, (cell / 9) * size, size, size);
+}
+
+int SudokuBoardWidget::cellAt(const QPointF& position) const
+{
+    qreal size = cellSize();
+    int row = static_cast<int>(position.y() / size);
+    int col = static_cast<int>(position.x() / size);
+
+    if (position.x() < 0 || position.y() < 0 || row > 8 || col > 8) {
+        return -1;
+    }
+    return row * 9 + col;
+}
+
+const QPixmap& SudokuBoardWidget::markTile(uint16_t candidates)
+{
+    // ------------------------------------------------------
+    // A new cell size or screen invalidates the whole atlas
+    // ------------------------------------------------------
+    qreal size = cellSize();
+    qreal ratio = devicePixelRatioF();
+    QSize pixels(qCeil(size * ratio), qCeil(size * ratio));
+
+    if (pixels != m_markTilePixels) {
+        m_markTiles.fill(QPixmap());
+        m_markTilePixels = pixels;
+    }
+
+    QPixmap& tile = m_markTiles[(candidates >> 1) & 0x1FF];
+    if (!tile.isNull()) {
+        return tile;
+    }
+
+    // ------------------------------------------------------
+    // Render the 3x3 layout of this mask once
+    // ------------------------------------------------------
+    tile = QPixmap(pixels);
+    tile.setDevicePixelRatio(ratio);
+    tile.fill(Qt::transparent);
+
+    QPainter painter(&tile);
+    painter.setFont(m_markFont);
+    painter.setPen(m_markColor);
+    qreal markSize = size / 3;
+
+    for (int digit = 1; digit <= 9; ++digit) {
+        if ((candidates & (1u << digit)) != 0) {
+            QRectF markRect(((digit - 1) % 3) * markSize, ((digit - 1) / 3) * markSize, markSize, markSize);
+            painter.drawText(markRect, Qt::AlignCenter, m_digitText[digit]);
+        }
+    }
+    return tile;
+}
+
+SudokuBitboard SudokuBoardWidget::selectionArea() const
+{
+    if (m_selected < 0) {
+        return SudokuBitboard{0, 0};
+    }
+    return SUDOKU_BITBOARDS.peers[m_selected] | SUDOKU_BITBOARDS.cells[m_selected];
+}
+
+void SudokuBoardWidget::updateCells(const SudokuBitboard& cells)
+{
+    QRegion region;
+    cells.forEachCell([&](int cell) {
+        region += cellRect(cell).toAlignedRect();
+    });
+
+    if (!region.isEmpty()) {
+        update(region);
+    }
+}
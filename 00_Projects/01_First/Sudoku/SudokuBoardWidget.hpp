@@ -0,0 +1,130 @@
+/**
+ * @file SudokuBoardWidget.hpp
+ * @brief Single custom-painted widget for the 9x9 board
+ *
+ * This header defines the board view used by the game window. One widget
+ * holds the display state of all 81 cells (value, given flag, conflict flag
+ * and pencil marks) plus the selection, and paints cells, highlights and
+ * grid lines in a single paintEvent from fonts and brushes built once.
+ * It handles mouse selection and keyboard entry itself, so changing the
+ * selection only schedules one repaint instead of re-polishing 81 styled
+ * child widgets. Highlight changes repaint only the cells they touch: the
+ * peers of the old and new selection and the cells gaining or losing the
+ * matching-digit highlight.
+ *
+ * Pencil marks are drawn from a tile atlas: the 3x3 layout of each of the
+ * 512 candidate masks is rendered once, the first time it is needed, at
+ * the current cell size and device pixel ratio, and every later cell with
+ * that mask is a single pixmap blit instead of up to nine text layouts.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#pragma once
+
+#include "SudokuBitboard.hpp"
+#include <QBrush>
+#include <QColor>
+#include <QFont>
+#include <QPen>
+#include <QPixmap>
+#include <QString>
+#include <QWidget>
+#include <array>
+#include <bitset>
+#include <cstdint>
+
+// =================================================
+// SudokuBoardWidget Class
+// =================================================
+
+class SudokuBoardWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit SudokuBoardWidget(QWidget *parent = nullptr);
+
+    // ------------------------------------------------------
+    // Cell State
+    // ------------------------------------------------------
+    int value(int row, int col) const { return m_values[row * 9 + col]; }
+    bool isInitial(int row, int col) const { return m_fixed[row * 9 + col]; }
+    void setCell(int row, int col, int value, bool initial);
+    void setValue(int row, int col, int value);
+    void setError(int row, int col, bool error);
+    void clearErrors();
+
+    // ------------------------------------------------------
+    // Pencil Marks (bit v = digit v)
+    // ------------------------------------------------------
+    void setCandidates(int row, int col, uint16_t candidates);
+    void setPencilMarksVisible(bool visible);
+
+    // ------------------------------------------------------
+    // Selection
+    // ------------------------------------------------------
+    void selectCell(int row, int col);   // Emits cellSelected
+    void clearSelection();
+    void setMatchingCells(const SudokuBitboard& cells);   // Highlighted as the selected digit
+    int selectedRow() const { return m_selected < 0 ? -1 : m_selected / 9; }
+    int selectedCol() const { return m_selected < 0 ? -1 : m_selected % 9; }
+
+    QSize sizeHint() const override { return QSize(540, 540); }
+
+signals:
+    void cellSelected(int row, int col);
+    void cellValueChanged(int row, int col, int value);   // User entry; not applied until pushed back
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void keyPressEvent(QKeyEvent *event) override;
+
+private:
+    // ------------------------------------------------------
+    // Private Data Members
+    // ------------------------------------------------------
+    std::array<uint8_t, SUDOKU_CELLS> m_values;
+    std::array<uint16_t, SUDOKU_CELLS> m_candidates;
+    std::bitset<SUDOKU_CELLS> m_fixed;
+    std::bitset<SUDOKU_CELLS> m_errors;
+    SudokuBitboard m_matching;
+    int m_selected;                       // Cell index, -1 = none
+    bool m_pencilMarksVisible;
+
+    // ------------------------------------------------------
+    // Paint Resources (built once)
+    // ------------------------------------------------------
+    QFont m_valueFont;
+    QFont m_markFont;
+    std::array<QString, 10> m_digitText;
+    QBrush m_cellBrush;
+    QBrush m_peerBrush;
+    QBrush m_matchBrush;
+    QBrush m_selectedBrush;
+    QBrush m_errorBrush;
+    QColor m_valueColor;
+    QColor m_givenColor;
+    QColor m_brightColor;
+    QColor m_markColor;
+    QPen m_thinPen;
+    QPen m_thickPen;
+    QPen m_selectionPen;
+    std::array<QPixmap, 512> m_markTiles;   // Index = candidate mask >> 1; null until first used
+    QSize m_markTilePixels;                 // Device pixels of every tile in the atlas
+
+    // ------------------------------------------------------
+    // Private Helper Methods
+    // ------------------------------------------------------
+    qreal cellSize() const;
+    QRectF cellRect(int cell) const;
+    int cellAt(const QPointF& position) const;
+    SudokuBitboard selectionArea() const;
+    void updateCells(const SudokuBitboard& cells);
+    const QPixmap& markTile(uint16_t candidates);
+    void enterValue(int value);
+};
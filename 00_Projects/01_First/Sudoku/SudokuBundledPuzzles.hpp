@@ -0,0 +1,159 @@
+/**
+ * @file SudokuBundledPuzzles.hpp
+ * @brief Built-in puzzles solved and rated at compile time
+ *
+ * This header holds the puzzles that ship with the game. Each bundled
+ * puzzle is parsed, solved, checked for a unique solution and rated while
+ * compiling, so the solutions and ratings are baked into the binary as
+ * constants and cost nothing at run time.
+ *
+ * The solving is done by the constexpr engine of SudokuBitboardSolver
+ * (assign, propagate, searchState) on classic rules, the same code the
+ * game runs at run time, so there is no second solver to keep in step.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#pragma once
+
+#include "SudokuBitboardSolver.hpp"
+#include "SudokuBoard.hpp"
+#include "SudokuGenerator.hpp"
+#include <array>
+#include <cstdint>
+
+// =================================================
+// Bundled Puzzle Structure
+// =================================================
+
+struct SudokuBundledPuzzle
+{
+    const char* name;
+    SudokuGrid givens;
+    SudokuGrid solution;
+    int clues;
+    int guesses;              // Branch points; 0 = propagation alone solves it
+    Difficulty difficulty;
+    bool unique;
+};
+
+// ------------------------------------------------------
+// Rating: propagation alone (singles, locked candidates) is
+// EASY, a handful of guesses is MEDIUM, real search is HARD
+// ------------------------------------------------------
+inline constexpr int BUNDLED_MEDIUM_MAX_GUESSES = 8;
+
+constexpr SudokuBundledPuzzle makeBundledPuzzle(const char* name, const char* text)
+{
+    SudokuBundledPuzzle puzzle{name, {}, {}, 0, 0, Difficulty::EASY, false};
+    SudokuBitboardState state = SudokuBitboardSolver::emptyState();
+    bool consistent = true;
+
+    // ------------------------------------------------------
+    // 81 characters, row-major; '.' or '0' for an empty cell
+    // ------------------------------------------------------
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        char c = text[cell];
+        if (c >= '1' && c <= '9') {
+            puzzle.givens[cell / SUDOKU_SIZE][cell % SUDOKU_SIZE] = c - '0';
+            consistent = SudokuBitboardSolver::assign(state, cell, c - '1', SudokuClassicRules{}) && consistent;
+            ++puzzle.clues;
+        }
+    }
+
+    if (!consistent) {
+        return puzzle;
+    }
+
+    // Two solutions are enough to tell unique from not
+    SudokuBitboardState solved{};
+    SudokuSearchStats stats;
+    int solutionCount = SudokuBitboardSolver::searchState(state, 2, &solved, SudokuClassicRules{}, stats,
+                                                          [](uint64_t) { return false; });
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        puzzle.solution[cell / SUDOKU_SIZE][cell % SUDOKU_SIZE] = solved.values[cell];
+    }
+    puzzle.guesses = static_cast<int>(stats.branches);
+    puzzle.unique = solutionCount == 1;
+    puzzle.difficulty = puzzle.guesses == 0 ? Difficulty::EASY
+                        : puzzle.guesses <= BUNDLED_MEDIUM_MAX_GUESSES ? Difficulty::MEDIUM
+                                                                       : Difficulty::HARD;
+    return puzzle;
+}
+
+// =================================================
+// Bundled Puzzles
+// =================================================
+
+// ------------------------------------------------------
+// One constant per puzzle keeps each compile-time solve within
+// the compilers' per-expression evaluation limits
+// ------------------------------------------------------
+inline constexpr SudokuBundledPuzzle BUNDLED_SPECIFICATION = makeBundledPuzzle("Specification sample",
+    "530070000600195000098000060800060003400803001700020006060000280000419005000080079");
+inline constexpr SudokuBundledPuzzle BUNDLED_EULER = makeBundledPuzzle("Project Euler 96, grid 01",
+    "003020600900305001001806400008102900700000008006708200002609500800203009005010300");
+inline constexpr SudokuBundledPuzzle BUNDLED_SEVENTEEN = makeBundledPuzzle("Seventeen clues",
+    "000000010400000000020000000000050407008000300001090000300400200050100000000806000");
+inline constexpr SudokuBundledPuzzle BUNDLED_MEDIUM_SAMPLE = makeBundledPuzzle("Medium sample",
+    "..9748...7.........2.1.9.....7...24..64.1.59..98...3.....8.3.2.........6...2759..");
+inline constexpr SudokuBundledPuzzle BUNDLED_LOCKED_CANDIDATES = makeBundledPuzzle("Locked candidates",
+    "85...24..72......9..4.........1.7..23.5...9...4...........8..7..17..........36.4.");
+inline constexpr SudokuBundledPuzzle BUNDLED_NORVIG_HARD = makeBundledPuzzle("Norvig, hard 1",
+    "4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......");
+inline constexpr SudokuBundledPuzzle BUNDLED_ESCARGOT = makeBundledPuzzle("AI Escargot",
+    "1....7.9..3..2...8..96..5....53..9...1..8...26....4...3......1..4......7..7...3..");
+
+inline constexpr std::array<SudokuBundledPuzzle, 7> SUDOKU_BUNDLED_PUZZLES = {{
+    BUNDLED_SPECIFICATION,
+    BUNDLED_EULER,
+    BUNDLED_SEVENTEEN,
+    BUNDLED_MEDIUM_SAMPLE,
+    BUNDLED_LOCKED_CANDIDATES,
+    BUNDLED_NORVIG_HARD,
+    BUNDLED_ESCARGOT
+}};
+
+// ------------------------------------------------------
+// Bundled puzzle with exactly these givens, or nullptr
+// ------------------------------------------------------
+constexpr const SudokuBundledPuzzle* findBundledPuzzle(const SudokuGrid& givens)
+{
+    for (const SudokuBundledPuzzle& puzzle : SUDOKU_BUNDLED_PUZZLES) {
+        if (puzzle.givens == givens) {
+            return &puzzle;
+        }
+    }
+    return nullptr;
+}
+
+// =================================================
+// Compile-time sanity checks
+// =================================================
+
+constexpr bool areBundledPuzzlesSound()
+{
+    for (const SudokuBundledPuzzle& puzzle : SUDOKU_BUNDLED_PUZZLES) {
+        if (!puzzle.unique) {
+            return false;
+        }
+        for (int row = 0; row < SUDOKU_SIZE; ++row) {
+            for (int col = 0; col < SUDOKU_SIZE; ++col) {
+                if (puzzle.givens[row][col] != 0 && puzzle.givens[row][col] != puzzle.solution[row][col]) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(areBundledPuzzlesSound(), "Every bundled puzzle must have one solution that keeps its givens");
+static_assert(BUNDLED_SPECIFICATION.solution[0][2] == 4, "Specification sample solves as published");
+static_assert(BUNDLED_SPECIFICATION.difficulty == Difficulty::EASY, "Specification sample needs no guessing");
+static_assert(BUNDLED_MEDIUM_SAMPLE.difficulty == Difficulty::MEDIUM, "Medium sample needs a few guesses");
+static_assert(BUNDLED_ESCARGOT.difficulty == Difficulty::HARD, "AI Escargot needs search");
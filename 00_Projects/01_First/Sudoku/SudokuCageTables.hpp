@@ -0,0 +1,97 @@
+/**
+ * @file SudokuCageTables.hpp
+ * @brief Compile-time sum-combination tables for Killer Sudoku cages
+ *
+ * A Killer cage is a group of cells whose distinct digits add up to a given
+ * sum. This header generates, at compile time, for every cage size (0-9),
+ * remaining sum (0-45) and set of still-allowed digits, the union of all
+ * combinations of that many distinct allowed digits with that sum. Pruning
+ * a cage is then one table lookup and a mask AND, at any search node.
+ *
+ * Digit masks here use bit d-1 for digit d (nine bits); the board's
+ * candidate masks use bit d, so board-facing code shifts by one.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#pragma once
+
+#include "SudokuTables.hpp"
+#include <array>
+#include <cstdint>
+
+// =================================================
+// Table dimensions
+// =================================================
+
+inline constexpr int MAX_CAGE_SUM = 45;                       // 1 + 2 + ... + 9
+inline constexpr int CAGE_DIGIT_MASKS = 1 << SUDOKU_UNIT_SIZE;
+inline constexpr uint16_t CAGE_ALL_DIGITS = CAGE_DIGIT_MASKS - 1;
+
+// =================================================
+// Table Structure
+// =================================================
+
+struct SudokuCageTables
+{
+    // digits[size][sum][allowed]: digits used by any combination (0 = none)
+    std::array<std::array<std::array<uint16_t, CAGE_DIGIT_MASKS>, MAX_CAGE_SUM + 1>, SUDOKU_UNIT_SIZE + 1> digits;
+};
+
+// =================================================
+// Compile-time generation
+// =================================================
+
+constexpr SudokuCageTables makeSudokuCageTables()
+{
+    SudokuCageTables tables{};
+
+    // ------------------------------------------------------
+    // Every digit set is one combination; it is reachable from
+    // every allowed-mask that contains it
+    // ------------------------------------------------------
+    for (int combination = 1; combination < CAGE_DIGIT_MASKS; ++combination) {
+        int size = 0;
+        int sum = 0;
+
+        for (int digit = 1; digit <= SUDOKU_UNIT_SIZE; ++digit) {
+            if ((combination >> (digit - 1)) & 1) {
+                ++size;
+                sum += digit;
+            }
+        }
+
+        for (int allowed = combination; allowed < CAGE_DIGIT_MASKS; allowed = (allowed + 1) | combination) {
+            tables.digits[size][sum][allowed] |= static_cast<uint16_t>(combination);
+        }
+    }
+
+    return tables;
+}
+
+inline constexpr SudokuCageTables SUDOKU_CAGE_TABLES = makeSudokuCageTables();
+
+// ------------------------------------------------------
+// Lookup with range checks: digits that can still complete `sum`
+// in `size` empty cells, using only `allowed` digits
+// ------------------------------------------------------
+constexpr uint16_t cageCombinationDigits(int size, int sum, uint16_t allowed)
+{
+    if (size < 1 || size > SUDOKU_UNIT_SIZE || sum < 1 || sum > MAX_CAGE_SUM) {
+        return 0;
+    }
+    return SUDOKU_CAGE_TABLES.digits[size][sum][allowed & CAGE_ALL_DIGITS];
+}
+
+// =================================================
+// Compile-time sanity checks
+// =================================================
+
+static_assert(cageCombinationDigits(2, 3, CAGE_ALL_DIGITS) == 0x003, "3 in two cells is 1+2");
+static_assert(cageCombinationDigits(2, 17, CAGE_ALL_DIGITS) == 0x180, "17 in two cells is 8+9");
+static_assert(cageCombinationDigits(2, 10, 0x1EF) == 0x1EF, "10 in two cells without 5 is 1+9, 2+8, 3+7, 4+6");
+static_assert(cageCombinationDigits(3, 6, 0x1FE) == 0, "6 in three cells needs the 1");
+static_assert(cageCombinationDigits(9, 45, CAGE_ALL_DIGITS) == CAGE_ALL_DIGITS, "A nine-cell cage holds every digit");
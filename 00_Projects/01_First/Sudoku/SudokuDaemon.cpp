@@ -0,0 +1,650 @@
+/**
+ * @file SudokuDaemon.cpp
+ * @brief Implementation of the local solver daemon
+ *
+ * This file implements the socket handling, request framing with
+ * per-connection backpressure, the worker pool and the latency histograms
+ * of SudokuDaemon.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#include "SudokuDaemon.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0   // No per-call flag here; the caller ignores SIGPIPE instead
+#endif
+
+namespace
+{
+    constexpr int SEND_TIMEOUT_SECONDS = 2;   // A client that stops reading is dropped
+    constexpr size_t READ_CHUNK = 4096;
+
+    bool hasBoardPayload(DaemonOp op)
+    {
+        return op == DaemonOp::SOLVE || op == DaemonOp::COUNT || op == DaemonOp::RATE;
+    }
+
+    // Difficulty by clue count, using the generator's ranges
+    Difficulty difficultyFromClues(int clues)
+    {
+        if (clues >= 36) {
+            return Difficulty::EASY;
+        }
+        return clues >= 30 ? Difficulty::MEDIUM : Difficulty::HARD;
+    }
+}
+
+// =================================================
+// Constructor & Destructor
+// =================================================
+
+SudokuDaemon::SudokuDaemon(const SudokuDaemonConfig& config)
+    : m_config(config)
+    , m_listenFd(-1)
+    , m_wakeFds{-1, -1}
+    , m_running(false)
+    , m_stopRequested(false)
+    , m_ioThread()
+    , m_clients()
+    , m_workers()
+    , m_queue()
+    , m_queueMutex()
+    , m_queueCondition()
+    , m_pool()
+    , m_poolMutex()
+    , m_histograms()
+{
+    if (m_config.workers <= 0) {
+        m_config.workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    m_config.maxBatch = std::max<size_t>(m_config.maxBatch, 1);
+    m_config.maxInFlight = std::max<size_t>(m_config.maxInFlight, 1);
+}
+
+SudokuDaemon::~SudokuDaemon()
+{
+    stop();
+}
+
+SudokuDaemon::Connection::~Connection()
+{
+    ::close(fd);
+}
+
+// =================================================
+// Service Control
+// =================================================
+
+bool SudokuDaemon::start()
+{
+    if (m_running) {
+        return true;
+    }
+    if (!openSocket()) {
+        return false;
+    }
+
+    // ------------------------------------------------------
+    // Warm-start the pool, then one thread per worker plus
+    // the I/O thread
+    // ------------------------------------------------------
+    if (!m_config.poolFile.empty()) {
+        m_pool.loadFromFile(m_config.poolFile);
+    }
+    m_pool.start();
+
+    m_stopRequested = false;
+    uint64_t seed = static_cast<uint64_t>(Clock::now().time_since_epoch().count());
+
+    for (int i = 0; i < m_config.workers; ++i) {
+        m_workers.push_back(std::make_unique<Worker>(seed + static_cast<uint64_t>(i) * 0x9E3779B97F4A7C15ull));
+        Worker& worker = *m_workers.back();
+        worker.batch.reserve(m_config.maxBatch);
+        worker.thread = std::thread(&SudokuDaemon::workerLoop, this, std::ref(worker));
+    }
+
+    m_ioThread = std::thread(&SudokuDaemon::ioLoop, this);
+    m_running = true;
+    return true;
+}
+
+void SudokuDaemon::stop()
+{
+    if (!m_running) {
+        return;
+    }
+
+    // ------------------------------------------------------
+    // Wake the I/O thread through the pipe and the workers
+    // through the queue condition
+    // ------------------------------------------------------
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_stopRequested = true;
+    }
+    wakeIoThread();
+    m_queueCondition.notify_all();
+
+    m_ioThread.join();
+    for (auto& worker : m_workers) {
+        worker->thread.join();
+    }
+    m_workers.clear();
+    m_queue.clear();
+
+    for (Client& client : m_clients) {
+        ::shutdown(client.connection->fd, SHUT_RDWR);
+    }
+    m_clients.clear();
+
+    ::close(m_listenFd);
+    ::close(m_wakeFds[0]);
+    ::close(m_wakeFds[1]);
+    ::unlink(m_config.socketPath.c_str());
+    m_listenFd = -1;
+    m_wakeFds[0] = m_wakeFds[1] = -1;
+
+    m_pool.stop();
+    if (!m_config.poolFile.empty()) {
+        m_pool.saveToFile(m_config.poolFile);
+    }
+    m_running = false;
+}
+
+// =================================================
+// Statistics
+// =================================================
+
+DaemonLatencyStats SudokuDaemon::getLatencyStats(DaemonOp op) const
+{
+    const LatencyHistogram& histogram = m_histograms[static_cast<int>(op)];
+    DaemonLatencyStats stats{};
+
+    stats.requests = histogram.requests.load(std::memory_order_relaxed);
+    stats.totalMicros = histogram.totalMicros.load(std::memory_order_relaxed);
+    stats.maxMicros = histogram.maxMicros.load(std::memory_order_relaxed);
+    for (int b = 0; b < DAEMON_HISTOGRAM_BUCKETS; ++b) {
+        stats.buckets[b] = histogram.buckets[b].load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+// =================================================
+// I/O Thread
+// =================================================
+
+bool SudokuDaemon::openSocket()
+{
+    sockaddr_un address{};
+    if (m_config.socketPath.empty() || m_config.socketPath.size() >= sizeof(address.sun_path)) {
+        return false;
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, m_config.socketPath.c_str(), m_config.socketPath.size() + 1);
+
+    if (::pipe(m_wakeFds) != 0) {
+        return false;
+    }
+
+    // ------------------------------------------------------
+    // Replace a stale socket left by a previous run; only the
+    // owner may connect
+    // ------------------------------------------------------
+    m_listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    ::unlink(m_config.socketPath.c_str());
+
+    if (m_listenFd < 0 || ::bind(m_listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::chmod(m_config.socketPath.c_str(), S_IRUSR | S_IWUSR) != 0 || ::listen(m_listenFd, SOMAXCONN) != 0) {
+        if (m_listenFd >= 0) {
+            ::close(m_listenFd);
+        }
+        ::close(m_wakeFds[0]);
+        ::close(m_wakeFds[1]);
+        m_listenFd = -1;
+        m_wakeFds[0] = m_wakeFds[1] = -1;
+        return false;
+    }
+
+    // A full wake pipe already means "look again", so wakes never block
+    ::fcntl(m_listenFd, F_SETFL, ::fcntl(m_listenFd, F_GETFL) | O_NONBLOCK);
+    ::fcntl(m_wakeFds[1], F_SETFL, ::fcntl(m_wakeFds[1], F_GETFL) | O_NONBLOCK);
+    return true;
+}
+
+void SudokuDaemon::ioLoop()
+{
+    std::vector<pollfd> fds;
+
+    while (!m_stopRequested) {
+        // ------------------------------------------------------
+        // Requests held back while their connection was at its
+        // in-flight limit go out as replies free room
+        // ------------------------------------------------------
+        for (size_t i = m_clients.size(); i-- > 0;) {
+            Client& client = m_clients[i];
+            if (client.input.size() >= sizeof(DaemonHeader) && hasRoom(client) && !parseRequests(client)) {
+                dropClient(i);
+            }
+        }
+
+        // ------------------------------------------------------
+        // [0] wake pipe, [1] listening socket, then one per client;
+        // a client at its limit is not read (hang-ups still show)
+        // ------------------------------------------------------
+        fds.clear();
+        fds.push_back(pollfd{m_wakeFds[0], POLLIN, 0});
+        fds.push_back(pollfd{m_listenFd, POLLIN, 0});
+        for (const Client& client : m_clients) {
+            fds.push_back(pollfd{client.connection->fd, static_cast<short>(hasRoom(client) ? POLLIN : 0), 0});
+        }
+
+        if (::poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        if (fds[0].revents != 0) {
+            char drain[64];
+            (void)!::read(m_wakeFds[0], drain, sizeof(drain));
+            if (m_stopRequested) {
+                break;
+            }
+        }
+
+        // Walk backwards so dropping a client keeps the indices valid
+        for (size_t i = m_clients.size(); i-- > 0;) {
+            if (fds[i + 2].revents != 0 && !readClient(m_clients[i])) {
+                dropClient(i);
+            }
+        }
+
+        if (fds[1].revents & POLLIN) {
+            acceptClients();
+        }
+    }
+}
+
+void SudokuDaemon::acceptClients()
+{
+    for (;;) {
+        int fd = ::accept(m_listenFd, nullptr, nullptr);
+        if (fd < 0) {
+            return;
+        }
+
+        // Blocking writes from the workers, bounded by a timeout
+        ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+        timeval timeout{SEND_TIMEOUT_SECONDS, 0};
+        ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+        m_clients.push_back(Client{std::make_shared<Connection>(fd), {}});
+    }
+}
+
+bool SudokuDaemon::readClient(Client& client)
+{
+    // poll() reported the socket readable, so one recv does not block
+    uint8_t chunk[READ_CHUNK];
+    ssize_t received = ::recv(client.connection->fd, chunk, sizeof(chunk), 0);
+
+    if (received <= 0) {
+        return received < 0 && (errno == EINTR || errno == EAGAIN);
+    }
+
+    client.input.insert(client.input.end(), chunk, chunk + received);
+    return parseRequests(client) && client.connection->open;
+}
+
+bool SudokuDaemon::parseRequests(Client& client)
+{
+    size_t offset = 0;
+    bool queued = false;
+    bool keep = true;
+
+    while (client.input.size() - offset >= sizeof(DaemonHeader) && hasRoom(client)) {
+        Request request{client.connection, {}, {}, Clock::now(), true};
+        std::memcpy(&request.header, client.input.data() + offset, sizeof(DaemonHeader));
+
+        // ------------------------------------------------------
+        // An oversized payload means the stream is out of step;
+        // nothing after it can be trusted
+        // ------------------------------------------------------
+        size_t payloadSize = request.header.payloadSize;
+        if (payloadSize > DAEMON_MAX_PAYLOAD) {
+            keep = false;
+            break;
+        }
+        if (client.input.size() - offset < sizeof(DaemonHeader) + payloadSize) {
+            break;
+        }
+
+        const uint8_t* payload = client.input.data() + offset + sizeof(DaemonHeader);
+        offset += sizeof(DaemonHeader) + payloadSize;
+
+        // ------------------------------------------------------
+        // Check the framing here (board contents are checked when
+        // unpacked); every request, even a malformed one, is answered
+        // by a worker so this thread never blocks on a send
+        // ------------------------------------------------------
+        DaemonOp op = static_cast<DaemonOp>(request.header.op);
+        request.wellFormed = request.header.op < DAEMON_OPS &&
+                             payloadSize == (hasBoardPayload(op) ? DAEMON_BOARD_BYTES : 0) &&
+                             (op != DaemonOp::GENERATE || request.header.arg < DIFFICULTY_LEVELS);
+
+        if (request.wellFormed && payloadSize != 0) {
+            std::memcpy(request.board.data(), payload, DAEMON_BOARD_BYTES);
+        }
+
+        client.connection->inFlight.fetch_add(1, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            m_queue.push_back(std::move(request));
+        }
+        queued = true;
+    }
+
+    client.input.erase(client.input.begin(), client.input.begin() + offset);
+    if (queued) {
+        m_queueCondition.notify_all();
+    }
+    return keep;
+}
+
+bool SudokuDaemon::hasRoom(const Client& client) const
+{
+    return client.connection->inFlight.load(std::memory_order_relaxed) < m_config.maxInFlight;
+}
+
+void SudokuDaemon::dropClient(size_t index)
+{
+    // Queued requests keep the connection alive; their replies are skipped
+    Connection& connection = *m_clients[index].connection;
+    connection.open = false;
+    ::shutdown(connection.fd, SHUT_RDWR);
+
+    m_clients[index] = std::move(m_clients.back());
+    m_clients.pop_back();
+}
+
+// =================================================
+// Workers
+// =================================================
+
+void SudokuDaemon::workerLoop(Worker& worker)
+{
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_queueCondition.wait(lock, [this] { return m_stopRequested || !m_queue.empty(); });
+            if (m_stopRequested) {
+                return;
+            }
+            takeBatch(worker);
+        }
+
+        const Request& first = worker.batch.front();
+        if (!first.wellFormed) {
+            reply(first, DaemonStatus::BAD_REQUEST);
+            worker.batch.clear();
+            continue;
+        }
+
+        switch (static_cast<DaemonOp>(first.header.op)) {
+        case DaemonOp::SOLVE:
+            for (const Request& request : worker.batch) {
+                handleSolve(worker, request);
+            }
+            break;
+        case DaemonOp::COUNT:
+            handleCount(worker, first);
+            break;
+        case DaemonOp::RATE:
+            handleRate(worker, first);
+            break;
+        case DaemonOp::GENERATE:
+            handleGenerate(worker, first);
+            break;
+        case DaemonOp::STATS:
+            handleStats(first);
+            break;
+        }
+        worker.batch.clear();
+    }
+}
+
+void SudokuDaemon::takeBatch(Worker& worker)
+{
+    worker.batch.push_back(std::move(m_queue.front()));
+    m_queue.pop_front();
+
+    auto isSolve = [](const Request& request) {
+        return request.wellFormed && static_cast<DaemonOp>(request.header.op) == DaemonOp::SOLVE;
+    };
+
+    if (!isSolve(worker.batch.front())) {
+        return;
+    }
+
+    // ------------------------------------------------------
+    // Gather the other queued solves, leaving the remaining
+    // requests in arrival order for the next worker
+    // ------------------------------------------------------
+    auto keep = m_queue.begin();
+    for (auto it = m_queue.begin(); it != m_queue.end(); ++it) {
+        if (isSolve(*it) && worker.batch.size() < m_config.maxBatch) {
+            worker.batch.push_back(std::move(*it));
+        } else {
+            if (keep != it) {
+                *keep = std::move(*it);
+            }
+            ++keep;
+        }
+    }
+    m_queue.erase(keep, m_queue.end());
+}
+
+void SudokuDaemon::handleSolve(Worker& worker, const Request& request)
+{
+    SudokuBoard board;
+    if (!unpackDaemonBoard(request.board.data(), board)) {
+        reply(request, DaemonStatus::BAD_REQUEST);
+        return;
+    }
+    if (!board.isBoardValid()) {
+        reply(request, DaemonStatus::UNSOLVABLE);
+        return;
+    }
+
+    // ------------------------------------------------------
+    // Same budget as count and rate, so one pathological board
+    // cannot hold a worker indefinitely
+    // ------------------------------------------------------
+    SolveResult result = worker.bitboardSolver.solve(board, m_config.limits);
+    if (result.status != SolveStatus::SOLVED) {
+        reply(request, result.status == SolveStatus::UNSOLVABLE ? DaemonStatus::UNSOLVABLE
+                                                                 : DaemonStatus::BUDGET_EXHAUSTED);
+        return;
+    }
+
+    DaemonPackedBoard solution = packDaemonBoard(board);
+    reply(request, DaemonStatus::OK, solution.data(), solution.size());
+}
+
+void SudokuDaemon::handleCount(Worker& worker, const Request& request)
+{
+    SudokuBoard board;
+    if (!unpackDaemonBoard(request.board.data(), board)) {
+        reply(request, DaemonStatus::BAD_REQUEST);
+        return;
+    }
+
+    DaemonCount count{0};
+    DaemonStatus status = DaemonStatus::OK;
+
+    // A board that breaks the rules has no solutions to count
+    if (board.isBoardValid()) {
+        int maxCount = request.header.arg != 0 ? request.header.arg : 2;
+        SolveResult result = worker.bitboardSolver.countSolutions(board, maxCount, m_config.limits);
+        count.count = static_cast<uint32_t>(result.solutionCount);
+        if (result.status == SolveStatus::BUDGET_EXHAUSTED) {
+            status = DaemonStatus::BUDGET_EXHAUSTED;
+        }
+    }
+    reply(request, status, &count, sizeof(count));
+}
+
+void SudokuDaemon::handleRate(Worker& worker, const Request& request)
+{
+    SudokuBoard board;
+    if (!unpackDaemonBoard(request.board.data(), board)) {
+        reply(request, DaemonStatus::BAD_REQUEST);
+        return;
+    }
+    if (!board.isBoardValid()) {
+        reply(request, DaemonStatus::UNSOLVABLE);
+        return;
+    }
+
+    SudokuBoard solution(board);
+    SolveResult result = worker.bitboardSolver.solve(solution, m_config.limits);
+    if (result.status != SolveStatus::SOLVED) {
+        reply(request, result.status == SolveStatus::UNSOLVABLE ? DaemonStatus::UNSOLVABLE
+                                                                 : DaemonStatus::BUDGET_EXHAUSTED);
+        return;
+    }
+
+    DaemonRating rating{};
+    rating.score = static_cast<uint32_t>(worker.checks.estimateDifficulty(board));
+    rating.logicalSteps = static_cast<uint32_t>(worker.checks.getRemainingSteps(board));
+    rating.searchNodes = static_cast<uint32_t>(std::min<uint64_t>(result.nodes, UINT32_MAX));
+    rating.clues = static_cast<uint8_t>(board.getFilledCount());
+    rating.difficulty = static_cast<uint8_t>(difficultyFromClues(board.getFilledCount()));
+    reply(request, DaemonStatus::OK, &rating, sizeof(rating));
+}
+
+void SudokuDaemon::handleGenerate(Worker& worker, const Request& request)
+{
+    Difficulty difficulty = static_cast<Difficulty>(request.header.arg);
+    SudokuBoard board;
+    bool pooled;
+
+    {
+        std::lock_guard<std::mutex> lock(m_poolMutex);
+        pooled = m_pool.tryPop(difficulty, board);
+    }
+
+    if (!pooled && !worker.generator.generate(board, difficulty)) {
+        reply(request, DaemonStatus::UNSOLVABLE);
+        return;
+    }
+
+    DaemonPackedBoard puzzle = packDaemonBoard(board);
+    reply(request, DaemonStatus::OK, puzzle.data(), puzzle.size());
+}
+
+void SudokuDaemon::handleStats(const Request& request)
+{
+    std::array<DaemonLatencyStats, DAEMON_OPS> stats;
+    for (int op = 0; op < DAEMON_OPS; ++op) {
+        stats[op] = getLatencyStats(static_cast<DaemonOp>(op));
+    }
+    reply(request, DaemonStatus::OK, stats.data(), sizeof(stats));
+}
+
+// =================================================
+// Replies & Statistics
+// =================================================
+
+void SudokuDaemon::reply(const Request& request, DaemonStatus status, const void* payload, size_t size)
+{
+    Connection& connection = *request.connection;
+
+    // ------------------------------------------------------
+    // Header and payload go out in one buffer so concurrent
+    // replies on one connection never interleave
+    // ------------------------------------------------------
+    std::vector<uint8_t> message(sizeof(DaemonHeader) + size);
+    DaemonHeader header{request.header.requestId, request.header.op, static_cast<uint8_t>(status),
+                        static_cast<uint16_t>(size)};
+    std::memcpy(message.data(), &header, sizeof(header));
+    if (size != 0) {
+        std::memcpy(message.data() + sizeof(header), payload, size);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(connection.writeMutex);
+        if (connection.open && !writeAll(connection.fd, message.data(), message.size())) {
+            // The I/O thread sees the shutdown as end of stream and drops the client
+            connection.open = false;
+            ::shutdown(connection.fd, SHUT_RDWR);
+        }
+    }
+
+    if (request.header.op < DAEMON_OPS) {
+        recordLatency(static_cast<DaemonOp>(request.header.op), request.received);
+    }
+
+    // A connection that was at its limit can be read again
+    if (connection.inFlight.fetch_sub(1, std::memory_order_relaxed) == m_config.maxInFlight) {
+        wakeIoThread();
+    }
+}
+
+void SudokuDaemon::recordLatency(DaemonOp op, Clock::time_point received)
+{
+    uint64_t micros = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - received).count());
+    LatencyHistogram& histogram = m_histograms[static_cast<int>(op)];
+
+    // Bucket b holds latencies in [2^b - 1, 2^(b+1) - 1) microseconds
+    int bucket = 0;
+    for (uint64_t scaled = micros + 1; scaled > 1 && bucket < DAEMON_HISTOGRAM_BUCKETS - 1; scaled >>= 1) {
+        ++bucket;
+    }
+
+    histogram.requests.fetch_add(1, std::memory_order_relaxed);
+    histogram.totalMicros.fetch_add(micros, std::memory_order_relaxed);
+    histogram.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t previous = histogram.maxMicros.load(std::memory_order_relaxed);
+    while (micros > previous &&
+           !histogram.maxMicros.compare_exchange_weak(previous, micros, std::memory_order_relaxed)) {
+    }
+}
+
+void SudokuDaemon::wakeIoThread()
+{
+    char wake = 0;
+    (void)!::write(m_wakeFds[1], &wake, 1);
+}
+
+bool SudokuDaemon::writeAll(int fd, const uint8_t* data, size_t size)
+{
+    while (size > 0) {
+        ssize_t sent = ::send(fd, data, size, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += sent;
+        size -= static_cast<size_t>(sent);
+    }
+    return true;
+}
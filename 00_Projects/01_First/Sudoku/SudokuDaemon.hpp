@@ -0,0 +1,200 @@
+/**
+ * @file SudokuDaemon.hpp
+ * @brief Long-running local solver service on a Unix domain socket
+ *
+ * This header defines the daemon that answers solve, count, rate and
+ * generate requests (see SudokuDaemonProtocol.hpp) for other processes on
+ * the same machine. It is built on the Qt-free core only.
+ *
+ * One I/O thread accepts clients and splits their byte streams into
+ * requests; it never writes. A pool of workers answers every request,
+ * malformed ones and STATS included, so a client that stops reading can
+ * only hold up the workers answering it, never the polling of others.
+ * Each connection may have a bounded number of requests in flight; past
+ * that its socket is not read until replies drain.
+ *
+ * A worker that picks up a solve request takes the other queued solve
+ * requests with it (up to maxBatch) and solves them one after another
+ * with its bitboard solver under the configured limits. Each worker keeps
+ * its own solvers and buffers for the daemon's lifetime, so requests pay
+ * no setup or allocation, and generate requests are served from a
+ * background puzzle pool when it has stock.
+ *
+ * Every request's latency (received to reply written) is recorded in a
+ * per-operation log2 histogram, readable with the STATS request.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#pragma once
+
+#include "SudokuAdvancedChecks.hpp"
+#include "SudokuBitboardSolver.hpp"
+#include "SudokuDaemonProtocol.hpp"
+#include "SudokuGenerator.hpp"
+#include "SudokuPuzzlePool.hpp"
+#include "SudokuSolveLimits.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// =================================================
+// Daemon Configuration
+// =================================================
+
+struct SudokuDaemonConfig
+{
+    std::string socketPath;
+    int workers = 0;                                          // 0 = one per hardware thread
+    size_t maxBatch = 64;                                     // Solve requests taken per dequeue
+    size_t maxInFlight = 64;                                  // Queued requests per connection
+    SolveLimits limits{0, std::chrono::milliseconds(2000)};   // Per solve/count/rate request
+    std::string poolFile;                                     // Empty = no pool persistence
+};
+
+// =================================================
+// SudokuDaemon Class
+// =================================================
+
+class SudokuDaemon
+{
+public:
+    // ------------------------------------------------------
+    // Constructor & Destructor
+    // ------------------------------------------------------
+    explicit SudokuDaemon(const SudokuDaemonConfig& config);
+    ~SudokuDaemon();
+
+    SudokuDaemon(const SudokuDaemon&) = delete;
+    SudokuDaemon& operator=(const SudokuDaemon&) = delete;
+
+    // ------------------------------------------------------
+    // Service Control
+    // ------------------------------------------------------
+    bool start();    // Binds the socket and starts the threads; false if the socket fails
+    void stop();     // Drops queued requests, joins the threads, removes the socket
+    bool isRunning() const { return m_running; }
+
+    // ------------------------------------------------------
+    // Statistics
+    // ------------------------------------------------------
+    DaemonLatencyStats getLatencyStats(DaemonOp op) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // ------------------------------------------------------
+    // Connections & Requests
+    // ------------------------------------------------------
+    struct Connection
+    {
+        explicit Connection(int socketFd) : fd(socketFd), open(true), inFlight(0) {}
+        ~Connection();   // Closes fd once no pending request refers to it
+
+        int fd;
+        std::mutex writeMutex;      // One reply on the wire at a time
+        std::atomic<bool> open;
+        std::atomic<size_t> inFlight;   // Queued or being answered
+    };
+
+    struct Client
+    {
+        std::shared_ptr<Connection> connection;
+        std::vector<uint8_t> input;   // Bytes of a request not fully received yet
+    };
+
+    struct Request
+    {
+        std::shared_ptr<Connection> connection;
+        DaemonHeader header;
+        DaemonPackedBoard board;
+        Clock::time_point received;
+        bool wellFormed;            // False: answered with BAD_REQUEST
+    };
+
+    // ------------------------------------------------------
+    // Per-worker state, reused across requests
+    // ------------------------------------------------------
+    struct Worker
+    {
+        explicit Worker(uint64_t seed) : generator(seed) {}
+
+        SudokuBitboardSolver bitboardSolver;  // Solving, counting and rating search
+        SudokuGenerator generator;            // When the pool is dry
+        SudokuAdvancedChecks checks;          // Logical rating
+        std::vector<Request> batch;
+        std::thread thread;
+    };
+
+    struct LatencyHistogram
+    {
+        std::atomic<uint64_t> requests{0};
+        std::atomic<uint64_t> totalMicros{0};
+        std::atomic<uint64_t> maxMicros{0};
+        std::array<std::atomic<uint32_t>, DAEMON_HISTOGRAM_BUCKETS> buckets{};
+    };
+
+    // ------------------------------------------------------
+    // Private Data Members
+    // ------------------------------------------------------
+    SudokuDaemonConfig m_config;
+    int m_listenFd;
+    int m_wakeFds[2];                      // Self-pipe that interrupts poll() on stop or freed capacity
+    std::atomic<bool> m_running;
+    std::atomic<bool> m_stopRequested;
+
+    std::thread m_ioThread;
+    std::vector<Client> m_clients;         // I/O thread only
+    std::vector<std::unique_ptr<Worker>> m_workers;
+
+    std::deque<Request> m_queue;
+    std::mutex m_queueMutex;
+    std::condition_variable m_queueCondition;
+
+    SudokuPuzzlePool m_pool;
+    std::mutex m_poolMutex;                // tryPop expects a single consumer
+
+    std::array<LatencyHistogram, DAEMON_OPS> m_histograms;
+
+    // ------------------------------------------------------
+    // I/O Thread
+    // ------------------------------------------------------
+    bool openSocket();
+    void ioLoop();
+    void acceptClients();
+    bool readClient(Client& client);       // False when the connection should be dropped
+    bool parseRequests(Client& client);
+    bool hasRoom(const Client& client) const;
+    void dropClient(size_t index);
+
+    // ------------------------------------------------------
+    // Workers
+    // ------------------------------------------------------
+    void workerLoop(Worker& worker);
+    void takeBatch(Worker& worker);        // Called with m_queueMutex held
+    void handleSolve(Worker& worker, const Request& request);
+    void handleCount(Worker& worker, const Request& request);
+    void handleRate(Worker& worker, const Request& request);
+    void handleGenerate(Worker& worker, const Request& request);
+    void handleStats(const Request& request);
+
+    // ------------------------------------------------------
+    // Replies & Statistics
+    // ------------------------------------------------------
+    void reply(const Request& request, DaemonStatus status, const void* payload = nullptr, size_t size = 0);
+    void recordLatency(DaemonOp op, Clock::time_point received);
+    void wakeIoThread();
+    static bool writeAll(int fd, const uint8_t* data, size_t size);
+};
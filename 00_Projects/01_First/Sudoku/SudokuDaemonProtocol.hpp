@@ -0,0 +1,134 @@
+/**
+ * @file SudokuDaemonProtocol.hpp
+ * @brief Binary request/response protocol of the local solver daemon
+ *
+ * This header defines the messages exchanged with the solver daemon over
+ * its Unix domain socket. Every message is an 8-byte header followed by
+ * payloadSize bytes. Boards travel packed, two cells per byte (41 bytes).
+ * Multi-byte fields use host byte order: the socket is local, so client
+ * and daemon always share it.
+ *
+ *   SOLVE     request: board             reply: solution (status OK)
+ *   COUNT     request: board, arg = cap  reply: DaemonCount
+ *   RATE      request: board             reply: DaemonRating
+ *   GENERATE  request: arg = Difficulty  reply: puzzle
+ *   STATS     request: -                 reply: DaemonLatencyStats per op
+ *
+ * Replies echo requestId and op and carry a DaemonStatus in arg; requests
+ * may be pipelined and replies can arrive in any order.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#pragma once
+
+#include "SudokuBoard.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// =================================================
+// Message Header
+// =================================================
+
+enum class DaemonOp : uint8_t
+{
+    SOLVE,
+    COUNT,
+    RATE,
+    GENERATE,
+    STATS
+};
+
+inline constexpr int DAEMON_OPS = 5;
+
+enum class DaemonStatus : uint8_t
+{
+    OK,
+    UNSOLVABLE,         // No solution (including boards that break the rules)
+    BUDGET_EXHAUSTED,   // The per-request time limit ran out
+    BAD_REQUEST         // Unknown op or wrong payload
+};
+
+struct DaemonHeader
+{
+    uint32_t requestId;     // Chosen by the client, echoed in the reply
+    uint8_t op;             // DaemonOp
+    uint8_t arg;            // Request argument, or DaemonStatus in a reply
+    uint16_t payloadSize;   // Bytes following the header
+};
+
+static_assert(sizeof(DaemonHeader) == 8, "The message header is 8 bytes");
+
+// =================================================
+// Payloads
+// =================================================
+
+inline constexpr size_t DAEMON_BOARD_BYTES = (SUDOKU_CELLS + 1) / 2;
+inline constexpr size_t DAEMON_MAX_PAYLOAD = DAEMON_BOARD_BYTES;   // Largest request payload
+
+using DaemonPackedBoard = std::array<uint8_t, DAEMON_BOARD_BYTES>;
+
+struct DaemonCount
+{
+    uint32_t count;         // Capped at the request's cap; a lower bound if the budget ran out
+};
+
+struct DaemonRating
+{
+    uint32_t score;             // SudokuAdvancedChecks::estimateDifficulty
+    uint32_t logicalSteps;      // Steps on the logical solve path
+    uint32_t searchNodes;       // Bitboard search nodes to solve it
+    uint8_t difficulty;         // Difficulty by clue count, as the generator defines it
+    uint8_t clues;
+    uint16_t reserved;
+};
+
+inline constexpr int DAEMON_HISTOGRAM_BUCKETS = 32;   // Bucket b: latency in [2^b - 1, 2^(b+1) - 1) us
+
+struct DaemonLatencyStats
+{
+    uint64_t requests;
+    uint64_t totalMicros;
+    uint64_t maxMicros;
+    std::array<uint32_t, DAEMON_HISTOGRAM_BUCKETS> buckets;
+};
+
+static_assert(sizeof(DaemonRating) == 16, "Rating payload layout");
+static_assert(sizeof(DaemonLatencyStats) == 24 + 4 * DAEMON_HISTOGRAM_BUCKETS, "Stats payload layout");
+
+// =================================================
+// Board Packing
+// =================================================
+
+inline DaemonPackedBoard packDaemonBoard(const SudokuBoard& board)
+{
+    DaemonPackedBoard packed{};
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        int value = board.getValue(SUDOKU_TABLES.cellRow[cell], SUDOKU_TABLES.cellCol[cell]);
+        packed[cell / 2] |= static_cast<uint8_t>(value << ((cell % 2) * 4));
+    }
+    return packed;
+}
+
+// False if a nibble holds something other than 0-9
+inline bool unpackDaemonBoard(const uint8_t* packed, SudokuBoard& board)
+{
+    SudokuGrid grid{};
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        int value = (packed[cell / 2] >> ((cell % 2) * 4)) & 0xF;
+        if (value > SUDOKU_SIZE) {
+            return false;
+        }
+        grid[SUDOKU_TABLES.cellRow[cell]][SUDOKU_TABLES.cellCol[cell]] = value;
+    }
+
+    board.clearAllFixedMarks();
+    board.setBoard(grid);
+    return true;
+}
@@ -0,0 +1,976 @@
+/**
+ * @file SudokuExactCounter.cpp
+ * @brief Implementation of exact counting by band decomposition
+ *
+ * This file implements the first-band enumeration with free-digit
+ * canonicalisation, the merging of symmetric column-set groups, the
+ * per-stack split of the remaining column sets, the memoized
+ * row-arrangement count of a single band, and the 128-bit arithmetic used
+ * to accumulate counts beyond 2^64.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#include "SudokuExactCounter.hpp"
+#include "SudokuBitboard.hpp"
+#include <algorithm>
+#include <utility>
+
+static int popCount(uint16_t mask)
+{
+    int count = 0;
+    while (mask != 0) {
+        mask &= static_cast<uint16_t>(mask - 1);
+        ++count;
+    }
+    return count;
+}
+
+static uint16_t lowestBit(uint16_t mask)
+{
+    return static_cast<uint16_t>(mask & (~mask + 1));
+}
+
+// The six orders of three columns (or stacks)
+static const int THREE_ORDERS[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+
+// Ways to split nine digits into three unordered triples: C(8,2) * C(5,2)
+static const int STACK_PARTITIONS = 280;
+static const uint64_t UNKNOWN_COUNT = ~uint64_t(0);
+
+// Most completions of any first band; the 44 band classes range from 6831977472 up to this
+static const uint64_t MAX_BAND_COMPLETIONS = 7802998272ull;
+
+// =================================================
+// SudokuCount128
+// =================================================
+
+void SudokuCount128::addProduct(uint64_t a, uint64_t b)
+{
+    // ------------------------------------------------------
+    // 64 x 64 -> 128 bit product from 32-bit halves
+    // ------------------------------------------------------
+    uint64_t aLo = a & 0xFFFFFFFFull, aHi = a >> 32;
+    uint64_t bLo = b & 0xFFFFFFFFull, bHi = b >> 32;
+
+    uint64_t lowLow = aLo * bLo;
+    uint64_t lowHigh = aLo * bHi;
+    uint64_t highLow = aHi * bLo;
+    uint64_t highHigh = aHi * bHi;
+
+    uint64_t middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFFull) + (highLow & 0xFFFFFFFFull);
+    uint64_t productLo = (lowLow & 0xFFFFFFFFull) | (middle << 32);
+    uint64_t productHi = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+
+    lo += productLo;
+    hi += productHi + (lo < productLo ? 1 : 0);
+}
+
+void SudokuCount128::multiply(uint64_t factor)
+{
+    SudokuCount128 result;
+    result.addProduct(lo, factor);
+    result.hi += hi * factor;
+    *this = result;
+}
+
+std::string SudokuCount128::toString() const
+{
+    // ------------------------------------------------------
+    // Long division by 10 over four 32-bit limbs
+    // ------------------------------------------------------
+    uint32_t limbs[4] = {static_cast<uint32_t>(hi >> 32), static_cast<uint32_t>(hi),
+                         static_cast<uint32_t>(lo >> 32), static_cast<uint32_t>(lo)};
+    std::string digits;
+
+    do {
+        uint64_t remainder = 0;
+        for (uint32_t& limb : limbs) {
+            uint64_t value = (remainder << 32) | limb;
+            limb = static_cast<uint32_t>(value / 10);
+            remainder = value % 10;
+        }
+        digits.push_back(static_cast<char>('0' + remainder));
+    } while (limbs[0] != 0 || limbs[1] != 0 || limbs[2] != 0 || limbs[3] != 0);
+
+    std::reverse(digits.begin(), digits.end());
+    return digits;
+}
+
+// =================================================
+// Constructor & Destructor
+// =================================================
+
+SudokuExactCounter::SudokuExactCounter()
+    : m_grid{}
+    , m_freeDigits(0)
+    , m_cancel(nullptr)
+    , m_nodes(0)
+    , m_bandFillings(0)
+{
+}
+
+SudokuExactCounter::~SudokuExactCounter()
+{
+}
+
+// =================================================
+// Counting Methods
+// =================================================
+
+SudokuExactCount SudokuExactCounter::count(const SudokuBoard& board, const SolveLimits& limits)
+{
+    SudokuExactCount result;
+
+    m_budget.start(limits, m_cancel);
+    m_nodes = 0;
+    m_bandFillings = 0;
+    m_groups.clear();
+    std::fill(m_bandCounts.begin(), m_bandCounts.end(), BandEntry{});
+
+    if (!board.isBoardValid()) {
+        result.elapsed = m_budget.finish(0, 0).elapsed;
+        return result;
+    }
+
+    // ------------------------------------------------------
+    // Orient the givens and find the interchangeable digits
+    // ------------------------------------------------------
+    m_grid = board.getBoard();
+    orientGrid();
+
+    uint16_t given = 0;
+    for (const auto& row : m_grid) {
+        for (int value : row) {
+            given |= static_cast<uint16_t>(1u << value);
+        }
+    }
+    m_freeDigits = static_cast<uint16_t>(0x3FE & ~given);
+
+    // ------------------------------------------------------
+    // Group the first band's fillings by column sets, merge
+    // groups that are column permutations of each other, then
+    // count the other two bands once per group
+    // ------------------------------------------------------
+    std::array<uint16_t, 3> rowUsed{};
+    std::array<uint16_t, 3> boxUsed{};
+    ColumnSets columns{};
+    enumerateFirstBand(0, rowUsed, boxUsed, columns, 0);
+    collapseGroups();
+
+    if (!m_budget.wasExhausted()) {
+        for (const auto& group : m_groups) {
+            uint64_t completions = countRemainingBands(group.first);
+            if (m_budget.wasExhausted()) {
+                break;
+            }
+            result.count.addProduct(group.second, completions);
+        }
+    }
+
+    // Every canonical solution stands for each ordering of the free digits
+    for (int factor = popCount(m_freeDigits); factor > 1; --factor) {
+        result.count.multiply(static_cast<uint64_t>(factor));
+    }
+
+    // ------------------------------------------------------
+    // An interrupted count is a lower bound
+    // ------------------------------------------------------
+    SolveResult summary = m_budget.finish(result.count.lo != 0 || result.count.hi != 0 ? 1 : 0, m_nodes);
+    result.status = summary.status;
+    result.elapsed = summary.elapsed;
+    result.nodes = m_nodes;
+    result.bandFillings = m_bandFillings;
+    result.columnGroups = m_groups.size();
+    return result;
+}
+
+// =================================================
+// Uniform Sampling
+// =================================================
+
+void SudokuExactCounter::sampleGrid(SudokuGrid& grid, SudokuRandom& rng)
+{
+    m_budget.start(SolveLimits{}, nullptr);
+    m_nodes = 0;
+    m_grid = SudokuGrid{};
+
+    // ------------------------------------------------------
+    // Each first band is proposed equally often; keeping it with
+    // probability completions / MAX_BAND_COMPLETIONS makes every
+    // complete grid equally likely (about nine in ten are kept)
+    // ------------------------------------------------------
+    ColumnSets first{};
+    uint64_t completions = 0;
+
+    do {
+        proposeFirstBand(rng);
+        for (int col = 0; col < SUDOKU_SIZE; ++col) {
+            first[col] = static_cast<uint16_t>((1u << m_grid[0][col]) | (1u << m_grid[1][col]) |
+                                               (1u << m_grid[2][col]));
+        }
+        completions = countRemainingBands(first);
+    } while (rng.below64(MAX_BAND_COMPLETIONS) >= completions);
+
+    // ------------------------------------------------------
+    // Pick one completion: its column sets for the other two
+    // bands, then each band's rows
+    // ------------------------------------------------------
+    std::array<ColumnSets, 2> later{};
+    countRemainingBands(first, &later, rng.below64(completions));
+
+    placeBand(1, later[0], rng);
+    placeBand(2, later[1], rng);
+    grid = m_grid;
+}
+
+// =================================================
+// Private Helper Methods
+// =================================================
+
+void SudokuExactCounter::orientGrid()
+{
+    // ------------------------------------------------------
+    // Transposing and swapping bands keep the solution count;
+    // put the band or stack with the most givens first
+    // ------------------------------------------------------
+    std::array<int, 3> bandGivenCount{};
+    std::array<int, 3> stackGivenCount{};
+
+    for (int row = 0; row < SUDOKU_SIZE; ++row) {
+        for (int col = 0; col < SUDOKU_SIZE; ++col) {
+            if (m_grid[row][col] != 0) {
+                ++bandGivenCount[row / 3];
+                ++stackGivenCount[col / 3];
+            }
+        }
+    }
+
+    int bestBand = static_cast<int>(std::max_element(bandGivenCount.begin(), bandGivenCount.end()) - bandGivenCount.begin());
+    int bestStack = static_cast<int>(std::max_element(stackGivenCount.begin(), stackGivenCount.end()) - stackGivenCount.begin());
+
+    if (stackGivenCount[bestStack] > bandGivenCount[bestBand]) {
+        SudokuGrid transposed{};
+        for (int row = 0; row < SUDOKU_SIZE; ++row) {
+            for (int col = 0; col < SUDOKU_SIZE; ++col) {
+                transposed[col][row] = m_grid[row][col];
+            }
+        }
+        m_grid = transposed;
+        bestBand = bestStack;
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        std::swap(m_grid[i], m_grid[bestBand * 3 + i]);
+    }
+}
+
+void SudokuExactCounter::collapseGroups()
+{
+    if (m_budget.wasExhausted()) {
+        return;
+    }
+
+    // ------------------------------------------------------
+    // Two changes to a whole grid map solutions to solutions:
+    // reordering columns (within stacks, then whole stacks) and
+    // relabelling digits. The ones that leave the second and
+    // third band's givens in place keep the number of
+    // completions of a first band's column sets.
+    // ------------------------------------------------------
+    uint16_t fixedDigits = 0;
+    for (int row = 3; row < SUDOKU_SIZE; ++row) {
+        for (int value : m_grid[row]) {
+            fixedDigits |= static_cast<uint16_t>(1u << value);
+        }
+    }
+    fixedDigits &= 0x3FE;
+    uint16_t freeDigits = static_cast<uint16_t>(0x3FE & ~fixedDigits);
+
+    // A digit's place is its column in each stack of the band, in base 3
+    static const int STACK_WEIGHT[3] = {9, 3, 1};
+    using PlaceMap = std::array<uint8_t, 27>;
+    std::vector<PlaceMap> symmetries;
+
+    for (const int* stacks : THREE_ORDERS) {
+        for (const int* first : THREE_ORDERS) {
+            for (const int* second : THREE_ORDERS) {
+                for (const int* third : THREE_ORDERS) {
+                    const int* within[3] = {first, second, third};
+                    bool fixesGivens = true;
+
+                    for (int col = 0; col < SUDOKU_SIZE && fixesGivens; ++col) {
+                        int from = stacks[col / 3] * 3 + within[col / 3][col % 3];
+                        for (int row = 3; row < SUDOKU_SIZE && fixesGivens; ++row) {
+                            fixesGivens = m_grid[row][from] == m_grid[row][col];
+                        }
+                    }
+                    if (!fixesGivens) {
+                        continue;
+                    }
+
+                    PlaceMap map{};
+                    for (int place = 0; place < 27; ++place) {
+                        for (int stack = 0; stack < 3; ++stack) {
+                            int oldColumn = place / STACK_WEIGHT[stacks[stack]] % 3;
+                            int newColumn = static_cast<int>(std::find(within[stack], within[stack] + 3, oldColumn) - within[stack]);
+                            map[place] = static_cast<uint8_t>(map[place] + STACK_WEIGHT[stack] * newColumn);
+                        }
+                    }
+                    symmetries.push_back(map);
+                }
+            }
+        }
+    }
+
+    // ------------------------------------------------------
+    // Key: the fixed digits' places in digit order, then the
+    // free digits' places sorted (their labels do not matter),
+    // five bits each
+    // ------------------------------------------------------
+    using PlaceKey = uint64_t;
+    using Places = std::array<uint8_t, 10>;
+
+    auto keyOf = [&](const Places& places, const PlaceMap& map) {
+        PlaceKey key = 0;
+        for (uint16_t bits = fixedDigits; bits != 0; bits &= static_cast<uint16_t>(bits - 1)) {
+            key = (key << 5) | map[places[bitboardLowestBit(bits)]];
+        }
+
+        std::array<uint8_t, SUDOKU_SIZE> sorted;
+        int count = 0;
+        for (uint16_t bits = freeDigits; bits != 0; bits &= static_cast<uint16_t>(bits - 1)) {
+            uint8_t place = map[places[bitboardLowestBit(bits)]];
+            int slot = count++;
+            for (; slot > 0 && sorted[slot - 1] > place; --slot) {
+                sorted[slot] = sorted[slot - 1];
+            }
+            sorted[slot] = place;
+        }
+        for (int i = 0; i < count; ++i) {
+            key = (key << 5) | sorted[i];
+        }
+        return key;
+    };
+
+    auto placesOf = [&](PlaceKey key) {
+        Places places{};
+        int shift = 5 * (SUDOKU_SIZE - 1);
+        for (uint16_t bits = fixedDigits; bits != 0; bits &= static_cast<uint16_t>(bits - 1), shift -= 5) {
+            places[bitboardLowestBit(bits)] = static_cast<uint8_t>((key >> shift) & 31);
+        }
+        for (uint16_t bits = freeDigits; bits != 0; bits &= static_cast<uint16_t>(bits - 1), shift -= 5) {
+            places[bitboardLowestBit(bits)] = static_cast<uint8_t>((key >> shift) & 31);
+        }
+        return places;
+    };
+
+    // ------------------------------------------------------
+    // Relabel alone first (cheap, and it merges most groups),
+    // then merge each remaining key's orbit under the column
+    // reorders into it; symmetries.front() is the identity
+    // ------------------------------------------------------
+    std::map<PlaceKey, uint64_t> relabelled;
+    for (const auto& group : m_groups) {
+        Places places{};
+        for (int col = 0; col < SUDOKU_SIZE; ++col) {
+            for (uint16_t bits = group.first[col]; bits != 0; bits &= static_cast<uint16_t>(bits - 1)) {
+                places[bitboardLowestBit(bits)] += static_cast<uint8_t>(STACK_WEIGHT[col / 3] * (col % 3));
+            }
+        }
+        relabelled[keyOf(places, symmetries.front())] += group.second;
+    }
+
+    std::map<PlaceKey, uint64_t> collapsed;
+    for (const auto& group : relabelled) {
+        if (group.second == 0) {
+            continue;   // Merged into an earlier key's orbit
+        }
+
+        Places places = placesOf(group.first);
+        uint64_t fillings = 0;
+        for (const PlaceMap& map : symmetries) {
+            auto image = relabelled.find(keyOf(places, map));
+            if (image != relabelled.end()) {
+                fillings += image->second;
+                image->second = 0;
+            }
+        }
+        collapsed[group.first] = fillings;
+    }
+
+    m_groups.clear();
+    for (const auto& group : collapsed) {
+        Places places = placesOf(group.first);
+        ColumnSets columns{};
+        for (int digit = 1; digit <= 9; ++digit) {
+            for (int stack = 0; stack < 3; ++stack) {
+                columns[stack * 3 + places[digit] / STACK_WEIGHT[stack] % 3] |= static_cast<uint16_t>(1u << digit);
+            }
+        }
+        m_groups[columns] = group.second;
+    }
+}
+
+void SudokuExactCounter::enumerateFirstBand(int cell, std::array<uint16_t, 3>& rowUsed,
+                                            std::array<uint16_t, 3>& boxUsed, ColumnSets& columns,
+                                            uint16_t placedFree)
+{
+    if (m_budget.exhausted(m_nodes)) {
+        return;
+    }
+    ++m_nodes;
+
+    if (cell == 3 * SUDOKU_SIZE) {
+        ++m_bandFillings;
+        ++m_groups[columns];
+        return;
+    }
+
+    int row = cell / SUDOKU_SIZE;
+    int col = cell % SUDOKU_SIZE;
+    int box = col / 3;
+
+    // ------------------------------------------------------
+    // Digits free in the row, box and column, not given further
+    // down the column or elsewhere in the row
+    // ------------------------------------------------------
+    uint16_t allowed = static_cast<uint16_t>(0x3FE & ~rowUsed[row] & ~boxUsed[box] & ~columns[col]);
+
+    for (int other = 3; other < SUDOKU_SIZE; ++other) {
+        allowed &= static_cast<uint16_t>(~(1u << m_grid[other][col]));
+    }
+
+    if (m_grid[row][col] != 0) {
+        allowed &= static_cast<uint16_t>(1u << m_grid[row][col]);
+    } else {
+        for (int other = 0; other < SUDOKU_SIZE; ++other) {
+            allowed &= static_cast<uint16_t>(~(1u << m_grid[row][other]));
+        }
+
+        // Unplaced free digits enter in increasing order (canonical labelling)
+        uint16_t unplaced = static_cast<uint16_t>(m_freeDigits & ~placedFree);
+        allowed = static_cast<uint16_t>((allowed & ~unplaced) | (allowed & lowestBit(unplaced)));
+    }
+    allowed &= 0x3FE;
+
+    for (uint16_t options = allowed; options != 0; options &= static_cast<uint16_t>(options - 1)) {
+        uint16_t bit = lowestBit(options);
+
+        rowUsed[row] |= bit;
+        boxUsed[box] |= bit;
+        columns[col] |= bit;
+
+        enumerateFirstBand(cell + 1, rowUsed, boxUsed, columns,
+                           static_cast<uint16_t>(placedFree | (bit & m_freeDigits)));
+
+        rowUsed[row] &= static_cast<uint16_t>(~bit);
+        boxUsed[box] &= static_cast<uint16_t>(~bit);
+        columns[col] &= static_cast<uint16_t>(~bit);
+    }
+}
+
+uint64_t SudokuExactCounter::countRemainingBands(const ColumnSets& first, std::array<ColumnSets, 2>* picked,
+                                                 uint64_t pick)
+{
+    BandGivens second = bandGivens(1);
+    BandGivens third = bandGivens(2);
+
+    // ------------------------------------------------------
+    // Per stack: each digit already sits in one column of the
+    // first band, so it goes to one of the other two columns in
+    // the second band and the last column in the third. Keep the
+    // splits that give every column three digits and agree with
+    // the givens (56 at most per stack).
+    // ------------------------------------------------------
+    using Split = std::array<uint16_t, 6>;   // Second-band masks, then third-band masks
+    std::array<std::vector<Split>, 3> splits;
+
+    for (int stack = 0; stack < 3; ++stack) {
+        int base = stack * 3;
+        std::array<int, 10> firstColumn{};
+
+        for (int k = 0; k < 3; ++k) {
+            for (int digit = 1; digit <= 9; ++digit) {
+                if ((first[base + k] & (1u << digit)) != 0) {
+                    firstColumn[digit] = k;
+                }
+            }
+        }
+
+        for (int choice = 0; choice < (1 << 9); ++choice) {
+            Split split{};
+
+            for (int digit = 1; digit <= 9; ++digit) {
+                int from = firstColumn[digit];
+                int to = (from + 1 + ((choice >> (digit - 1)) & 1)) % 3;
+                int last = 3 - from - to;
+                split[to] |= static_cast<uint16_t>(1u << digit);
+                split[3 + last] |= static_cast<uint16_t>(1u << digit);
+            }
+
+            bool valid = popCount(split[0]) == 3 && popCount(split[1]) == 3 && popCount(split[2]) == 3;
+
+            for (int k = 0; k < 3 && valid; ++k) {
+                for (int row = 0; row < 3; ++row) {
+                    int secondValue = second[row][base + k];
+                    int thirdValue = third[row][base + k];
+                    valid = valid && (secondValue == 0 || (split[k] & (1u << secondValue)) != 0);
+                    valid = valid && (thirdValue == 0 || (split[3 + k] & (1u << thirdValue)) != 0);
+                }
+            }
+
+            if (valid) {
+                splits[stack].push_back(split);
+            }
+        }
+    }
+
+    // ------------------------------------------------------
+    // Swapping columns inside a stack keeps a band's count when
+    // the band has no givens, so such a band is counted once per
+    // shape (each stack's column sets in sorted order)
+    // ------------------------------------------------------
+    using Shape = StackShape;
+    std::array<std::vector<Shape>, 3> shapes;
+    std::array<std::vector<std::array<int, 2>>, 3> shapeOf;   // Per split: second-band, third-band shape
+
+    for (int stack = 0; stack < 3; ++stack) {
+        for (const Split& split : splits[stack]) {
+            std::array<int, 2> ids{};
+
+            for (int half = 0; half < 2; ++half) {
+                Shape shape = {split[3 * half], split[3 * half + 1], split[3 * half + 2]};
+                std::sort(shape.begin(), shape.end());
+
+                auto found = std::find(shapes[stack].begin(), shapes[stack].end(), shape);
+                ids[half] = static_cast<int>(found - shapes[stack].begin());
+                if (found == shapes[stack].end()) {
+                    shapes[stack].push_back(shape);
+                }
+            }
+            shapeOf[stack].push_back(ids);
+        }
+    }
+
+    // ------------------------------------------------------
+    // A band without givens is counted by how its second and
+    // third stacks split the digits once the first stack is
+    // relabelled to {1,2,3}, {4,5,6}, {7,8,9} (see shapeCount)
+    // ------------------------------------------------------
+    std::array<bool, 2> shaped = {!hasGivens(second), !hasGivens(third)};
+    std::array<std::vector<int>, 2> partitionOf;   // By first-stack shape, then second or third
+
+    if (shaped[0] || shaped[1]) {
+        if (m_shapeCounts.empty()) {
+            m_shapeCounts.assign(STACK_PARTITIONS * STACK_PARTITIONS, UNKNOWN_COUNT);
+        }
+        for (int later = 0; later < 2; ++later) {
+            for (const Shape& first : shapes[0]) {
+                for (const Shape& shape : shapes[later + 1]) {
+                    partitionOf[later].push_back(partitionIndex(relabelStack(first, shape)));
+                }
+            }
+        }
+    }
+
+    auto bandCount = [&](int half, const BandGivens& givens, int i, int j, int k) -> uint64_t {
+        const Split* parts[3] = {&splits[0][i], &splits[1][j], &splits[2][k]};
+        ColumnSets columns;
+
+        if (!shaped[half]) {
+            for (int stack = 0; stack < 3; ++stack) {
+                for (int col = 0; col < 3; ++col) {
+                    columns[stack * 3 + col] = (*parts[stack])[3 * half + col];
+                }
+            }
+
+            uint64_t key = static_cast<uint64_t>(half + 1) << 54;
+            for (int stack = 0; stack < 3; ++stack) {
+                key |= static_cast<uint64_t>(columns[stack * 3] >> 1) << (18 * stack);
+                key |= static_cast<uint64_t>(columns[stack * 3 + 1] >> 1) << (18 * stack + 9);
+            }
+
+            if (m_bandCounts.empty()) {
+                m_bandCounts.resize(BAND_ENTRIES);
+            }
+            BandEntry& entry = m_bandCounts[((key * 0x9E3779B97F4A7C15ull) >> 32) & (BAND_ENTRIES - 1)];
+            if (entry.key != key) {
+                entry.key = key;
+                entry.count = countBand(columns, givens);
+            }
+            return entry.count;
+        }
+
+        int a = shapeOf[0][i][half], b = shapeOf[1][j][half], c = shapeOf[2][k][half];
+        uint64_t& cached = m_shapeCounts[partitionOf[0][a * shapes[1].size() + b] * STACK_PARTITIONS +
+                                         partitionOf[1][a * shapes[2].size() + c]];
+        if (cached == UNKNOWN_COUNT) {
+            cached = shapeCount(shapes[0][a], shapes[1][b], shapes[2][c]);
+        }
+        return cached;
+    };
+
+    // ------------------------------------------------------
+    // Combine one split per stack; the two bands are independent
+    // once their column sets are fixed
+    // ------------------------------------------------------
+    uint64_t total = 0;
+
+    for (int i = 0; i < static_cast<int>(splits[0].size()); ++i) {
+        for (int j = 0; j < static_cast<int>(splits[1].size()); ++j) {
+            for (int k = 0; k < static_cast<int>(splits[2].size()); ++k) {
+                if (m_budget.exhausted(m_nodes)) {
+                    return total;
+                }
+                ++m_nodes;
+
+                uint64_t secondCount = bandCount(0, second, i, j, k);
+                if (secondCount == 0) {
+                    continue;
+                }
+                uint64_t ways = secondCount * bandCount(1, third, i, j, k);
+
+                // Sampling: stop at the combination holding completion `pick`
+                if (picked != nullptr && pick < total + ways) {
+                    const Split* parts[3] = {&splits[0][i], &splits[1][j], &splits[2][k]};
+                    for (int half = 0; half < 2; ++half) {
+                        for (int col = 0; col < SUDOKU_SIZE; ++col) {
+                            (*picked)[half][col] = (*parts[col / 3])[3 * half + col % 3];
+                        }
+                    }
+                    return total + ways;
+                }
+                total += ways;
+            }
+        }
+    }
+
+    return total;
+}
+
+uint64_t SudokuExactCounter::shapeCount(const StackShape& first, const StackShape& second, const StackShape& third)
+{
+    StackShape middle = relabelStack(first, second);
+    StackShape right = relabelStack(first, third);
+    ColumnSets columns = {0x000E, 0x0070, 0x0380, middle[0], middle[1], middle[2], right[0], right[1], right[2]};
+    return countBand(columns, BandGivens{});
+}
+
+uint64_t SudokuExactCounter::countBand(const ColumnSets& columns, const BandGivens& givens)
+{
+    // ------------------------------------------------------
+    // Ways to order each column's three digits into rows so that
+    // every row is a permutation. A given fixes its cell and is
+    // kept out of the other cells of its row and column.
+    // ------------------------------------------------------
+    std::array<ColumnSets, 3> forbidden{};
+
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < SUDOKU_SIZE; ++col) {
+            int value = givens[row][col];
+            if (value == 0) {
+                continue;
+            }
+            uint16_t bit = static_cast<uint16_t>(1u << value);
+            forbidden[row][col] |= static_cast<uint16_t>(0x3FE & ~bit);
+            for (int other = 0; other < SUDOKU_SIZE; ++other) {
+                if (other != col) {
+                    forbidden[row][other] |= bit;
+                }
+            }
+            for (int other = 0; other < 3; ++other) {
+                if (other != row) {
+                    forbidden[other][col] |= bit;
+                }
+            }
+        }
+    }
+
+    if (hasGivens(givens)) {
+        return countBandRows(0, columns, forbidden, true);
+    }
+
+    // Without givens the rows are interchangeable: fix the top digit
+    // of the first column and count each of its three choices once
+    forbidden[0][0] = static_cast<uint16_t>(columns[0] & (columns[0] - 1));
+    return 3 * countBandRows(0, columns, forbidden, false);
+}
+
+uint64_t SudokuExactCounter::countBandRows(int row, const ColumnSets& remaining,
+                                           const std::array<ColumnSets, 3>& forbidden, bool hasGivens)
+{
+    // Two permutation rows leave one digit per column: the last row
+    if (row == 2) {
+        for (int col = 0; col < SUDOKU_SIZE; ++col) {
+            if ((remaining[col] & forbidden[2][col]) != 0) {
+                return 0;
+            }
+        }
+        return 1;
+    }
+
+    // ------------------------------------------------------
+    // Without givens the middle row has a closed form: every digit
+    // is left in two columns, linking them, so the columns fall
+    // into disjoint cycles and each cycle can be read either way
+    // ------------------------------------------------------
+    if (row == 1 && !hasGivens) {
+        std::array<int, SUDOKU_SIZE> parent;
+        std::array<int, 10> seenIn;
+        seenIn.fill(-1);
+        int cycles = SUDOKU_SIZE;
+
+        for (int col = 0; col < SUDOKU_SIZE; ++col) {
+            parent[col] = col;
+        }
+
+        for (int col = 0; col < SUDOKU_SIZE; ++col) {
+            for (uint16_t bits = remaining[col]; bits != 0; bits &= static_cast<uint16_t>(bits - 1)) {
+                int digit = bitboardLowestBit(bits);
+                if (seenIn[digit] < 0) {
+                    seenIn[digit] = col;
+                    continue;
+                }
+
+                int a = seenIn[digit];
+                int b = col;
+                while (parent[a] != a) {
+                    a = parent[a];
+                }
+                while (parent[b] != b) {
+                    b = parent[b];
+                }
+                if (a != b) {
+                    parent[a] = b;
+                    --cycles;
+                }
+            }
+        }
+        return uint64_t(1) << cycles;
+    }
+
+    // ------------------------------------------------------
+    // A row is one digit from each column. Pick the first two
+    // stacks' digits without repeats; the third stack must then
+    // take exactly the digits left over, one per column.
+    // ------------------------------------------------------
+    std::array<uint16_t, SUDOKU_SIZE> open;
+    for (int col = 0; col < SUDOKU_SIZE; ++col) {
+        open[col] = static_cast<uint16_t>(remaining[col] & ~forbidden[row][col]);
+    }
+
+    uint64_t total = 0;
+    ColumnSets next;
+
+    for (uint16_t a = open[0]; a != 0; a &= static_cast<uint16_t>(a - 1)) {
+        for (uint16_t b = open[1]; b != 0; b &= static_cast<uint16_t>(b - 1)) {
+            for (uint16_t c = open[2]; c != 0; c &= static_cast<uint16_t>(c - 1)) {
+                uint16_t left = static_cast<uint16_t>(lowestBit(a) | lowestBit(b) | lowestBit(c));
+
+                for (uint16_t d = open[3] & ~left; d != 0; d &= static_cast<uint16_t>(d - 1)) {
+                    for (uint16_t e = open[4] & ~left; e != 0; e &= static_cast<uint16_t>(e - 1)) {
+                        for (uint16_t f = open[5] & ~left; f != 0; f &= static_cast<uint16_t>(f - 1)) {
+                            uint16_t middle = static_cast<uint16_t>(lowestBit(d) | lowestBit(e) | lowestBit(f));
+                            uint16_t right = static_cast<uint16_t>(0x3FE & ~(left | middle));
+
+                            bool valid = true;
+                            for (int col = 6; col < SUDOKU_SIZE && valid; ++col) {
+                                uint16_t taken = static_cast<uint16_t>(right & open[col]);
+                                valid = taken != 0 && (taken & (taken - 1)) == 0;
+                            }
+                            if (!valid) {
+                                continue;
+                            }
+
+                            for (int col = 0; col < SUDOKU_SIZE; ++col) {
+                                uint16_t rowDigits = col < 3 ? left : (col < 6 ? middle : right);
+                                next[col] = static_cast<uint16_t>(remaining[col] & ~rowDigits);
+                            }
+                            total += countBandRows(row + 1, next, forbidden, hasGivens);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return total;
+}
+
+bool SudokuExactCounter::hasGivens(const BandGivens& givens)
+{
+    for (const auto& row : givens) {
+        for (uint8_t value : row) {
+            if (value != 0) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+SudokuExactCounter::StackShape SudokuExactCounter::relabelStack(const StackShape& first, const StackShape& shape)
+{
+    // ------------------------------------------------------
+    // A band without givens keeps its count when digits are
+    // relabelled; relabel so `first` becomes {1,2,3}, {4,5,6},
+    // {7,8,9}, leaving 280 x 280 band shapes shared by every
+    // group and every call
+    // ------------------------------------------------------
+    std::array<uint16_t, 10> label{};
+    for (int col = 0; col < 3; ++col) {
+        int next = col * 3 + 1;
+        for (uint16_t bits = first[col]; bits != 0; bits &= static_cast<uint16_t>(bits - 1)) {
+            label[bitboardLowestBit(bits)] = static_cast<uint16_t>(1u << next++);
+        }
+    }
+
+    StackShape result{};
+    for (int col = 0; col < 3; ++col) {
+        for (uint16_t bits = shape[col]; bits != 0; bits &= static_cast<uint16_t>(bits - 1)) {
+            result[col] |= label[bitboardLowestBit(bits)];
+        }
+    }
+    return result;
+}
+
+int SudokuExactCounter::partitionIndex(const StackShape& shape)
+{
+    // ------------------------------------------------------
+    // The triple holding digit 1 is one of C(8,2) pairs added to
+    // it; the triple holding the lowest digit left is one of
+    // C(5,2) pairs added to that
+    // ------------------------------------------------------
+    auto pairRank = [](uint16_t pair, uint16_t pool) {
+        int rank = 0;
+        for (uint16_t a = pool; a != 0; a &= static_cast<uint16_t>(a - 1)) {
+            for (uint16_t b = static_cast<uint16_t>(a & (a - 1)); b != 0; b &= static_cast<uint16_t>(b - 1)) {
+                if ((lowestBit(a) | lowestBit(b)) == pair) {
+                    return rank;
+                }
+                ++rank;
+            }
+        }
+        return rank;
+    };
+
+    uint16_t left = 0x3FE;
+    std::array<uint16_t, 2> triples{};
+
+    for (int part = 0; part < 2; ++part) {
+        uint16_t lowest = lowestBit(left);
+        for (uint16_t mask : shape) {
+            if ((mask & lowest) != 0) {
+                triples[part] = mask;
+            }
+        }
+        left = static_cast<uint16_t>(left & ~triples[part]);
+    }
+
+    uint16_t firstRest = static_cast<uint16_t>(triples[0] & ~lowestBit(triples[0]));
+    uint16_t secondRest = static_cast<uint16_t>(triples[1] & ~lowestBit(triples[1]));
+    uint16_t secondPool = static_cast<uint16_t>(0x3FE & ~triples[0] & ~lowestBit(triples[1]));
+
+    return pairRank(firstRest, static_cast<uint16_t>(0x3FC)) * 10 + pairRank(secondRest, secondPool);
+}
+
+SudokuExactCounter::BandGivens SudokuExactCounter::bandGivens(int band) const
+{
+    BandGivens givens{};
+
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < SUDOKU_SIZE; ++col) {
+            givens[row][col] = static_cast<uint8_t>(m_grid[band * 3 + row][col]);
+        }
+    }
+    return givens;
+}
+
+void SudokuExactCounter::proposeFirstBand(SudokuRandom& rng)
+{
+    // ------------------------------------------------------
+    // A uniform band: any first row; a second row keeping every
+    // box free of repeats (about one shuffle in thirty is);
+    // then each box's three remaining digits in any order
+    // ------------------------------------------------------
+    std::array<int, SUDOKU_SIZE> top = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    rng.shuffle(top.begin(), top.end());
+
+    std::array<uint16_t, 3> topBox{};
+    for (int col = 0; col < SUDOKU_SIZE; ++col) {
+        topBox[col / 3] |= static_cast<uint16_t>(1u << top[col]);
+    }
+
+    std::array<int, SUDOKU_SIZE> middle = top;
+    bool separate = false;
+
+    while (!separate) {
+        rng.shuffle(middle.begin(), middle.end());
+        separate = true;
+        for (int col = 0; col < SUDOKU_SIZE && separate; ++col) {
+            separate = (topBox[col / 3] & (1u << middle[col])) == 0;
+        }
+    }
+
+    for (int box = 0; box < 3; ++box) {
+        uint16_t used = topBox[box];
+        for (int col = box * 3; col < box * 3 + 3; ++col) {
+            used |= static_cast<uint16_t>(1u << middle[col]);
+        }
+
+        std::array<int, 3> bottom{};
+        int count = 0;
+        for (uint16_t bits = static_cast<uint16_t>(0x3FE & ~used); bits != 0; bits &= static_cast<uint16_t>(bits - 1)) {
+            bottom[count++] = bitboardLowestBit(bits);
+        }
+        rng.shuffle(bottom.begin(), bottom.end());
+
+        for (int k = 0; k < 3; ++k) {
+            m_grid[0][box * 3 + k] = top[box * 3 + k];
+            m_grid[1][box * 3 + k] = middle[box * 3 + k];
+            m_grid[2][box * 3 + k] = bottom[k];
+        }
+    }
+}
+
+void SudokuExactCounter::placeBand(int band, const ColumnSets& columns, SudokuRandom& rng)
+{
+    // ------------------------------------------------------
+    // Fill the band cell by cell, choosing each digit of the
+    // column's set in proportion to the arrangements it leaves
+    // ------------------------------------------------------
+    BandGivens givens{};
+
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < SUDOKU_SIZE; ++col) {
+            uint16_t options = columns[col];
+            for (int above = 0; above < row; ++above) {
+                options &= static_cast<uint16_t>(~(1u << givens[above][col]));
+            }
+
+            std::array<uint64_t, 10> ways{};
+            uint64_t total = 0;
+            for (uint16_t bits = options; bits != 0; bits &= static_cast<uint16_t>(bits - 1)) {
+                int digit = bitboardLowestBit(bits);
+                givens[row][col] = static_cast<uint8_t>(digit);
+                ways[digit] = countBand(columns, givens);
+                total += ways[digit];
+            }
+
+            uint64_t pick = rng.below64(total);
+            for (uint16_t bits = options; bits != 0; bits &= static_cast<uint16_t>(bits - 1)) {
+                int digit = bitboardLowestBit(bits);
+                givens[row][col] = static_cast<uint8_t>(digit);
+                if (pick < ways[digit]) {
+                    break;
+                }
+                pick -= ways[digit];
+            }
+            m_grid[band * 3 + row][col] = givens[row][col];
+        }
+    }
+}
@@ -3,7 +3,7 @@
  * @brief Implementation of Qt GUI and game logic
  *
  * This file implements the Qt-based graphical interface including the
- * custom cell widgets, number pad, menu handlers, and game state management.
+ * board view wiring, number pad, menu handlers, and game state management.
  *
  * @author Salah-Eldin Hassen
  * @date December 2025
@@ -13,278 +13,20 @@
 
 #include "SudokuGame.hpp"
 #include "./ui_sudoku.h"
+#include "SudokuBundledPuzzles.hpp"
 
 #include <QMessageBox>
 #include <QFileDialog>
-#include <QKeyEvent>
-#include <QFocusEvent>
-#include <QFont>
+#include <QDir>
+#include <QFileInfo>
+#include <QStandardPaths>
 
-// =================================================
-// SudokuCell Implementation
-// =================================================
-
-SudokuCell::SudokuCell(int row, int col, QWidget *parent)
-    : QLineEdit(parent)
-    , m_row(row)
-    , m_col(col)
-    , m_initial(false)
-    , m_highlighted(false)
-    , m_matchingNumber(false)
-    , m_error(false)
-    , m_selected(false)
-    , m_showPencilMarks(false)
-{
-    setMaxLength(1);
-    setAlignment(Qt::AlignCenter);
-    setFixedSize(60, 60);
-    
-    QFont font = this->font();
-    font.setPointSize(20);
-    font.setBold(true);
-    setFont(font);
-    
-    // Create label overlay for grid display
-    m_gridLabel = new QLabel(this);
-    m_gridLabel->setAlignment(Qt::AlignCenter);
-    m_gridLabel->setGeometry(0, 0, 60, 60);
-    m_gridLabel->setAttribute(Qt::WA_TransparentForMouseEvents);
-    QFont gridFont("Courier", 9);
-    m_gridLabel->setFont(gridFont);
-    m_gridLabel->setStyleSheet("QLabel { color: #7f8c8d; background: transparent; }");
-    
-    updateStyle();
-    updateDisplay();
-    
-    // ------------------------------------------------------
-    // Connect text change to value change signal
-    // ------------------------------------------------------
-    connect(this, &QLineEdit::textChanged, this, [this](const QString &text) {
-        if (!text.isEmpty()) {
-            bool ok;
-            int val = text.toInt(&ok);
-            if (ok && val >= 1 && val <= 9) {
-                emit cellValueChanged(m_row, m_col, val);
-            }
-        } else {
-            emit cellValueChanged(m_row, m_col, 0);
-        }
-        updateDisplay();
-    });
-}
-
-void SudokuCell::setInitial(bool initial)
-{
-    m_initial = initial;
-    setReadOnly(initial);
-    updateStyle();
-}
-
-void SudokuCell::setHighlighted(bool highlighted)
-{
-    m_highlighted = highlighted;
-    updateStyle();
-}
-
-void SudokuCell::setMatchingNumber(bool matching)
-{
-    m_matchingNumber = matching;
-    updateStyle();
-}
-
-void SudokuCell::setError(bool error)
-{
-    m_error = error;
-    updateStyle();
-}
-
-void SudokuCell::setSelected(bool selected)
-{
-    m_selected = selected;
-    updateStyle();
-}
-
-int SudokuCell::value() const
-{
-    bool ok;
-    int val = text().toInt(&ok);
-    return ok ? val : 0;
-}
-
-void SudokuCell::setValue(int val)
-{
-    if (val >= 1 && val <= 9) {
-        setText(QString::number(val));
-    } else {
-        clear();
-    }
-    updateDisplay();
-}
-
-void SudokuCell::clearValue()
-{
-    if (!m_initial) {
-        clear();
-    }
-}
-
-void SudokuCell::focusInEvent(QFocusEvent *event)
-{
-    QLineEdit::focusInEvent(event);
-    emit cellSelected(m_row, m_col);
-}
-
-void SudokuCell::keyPressEvent(QKeyEvent *event)
-{
-    int key = event->key();
-    
-    // ------------------------------------------------------
-    // Handle number keys (1-9)
-    // ------------------------------------------------------
-    if (key >= Qt::Key_1 && key <= Qt::Key_9) {
-        if (!m_initial) {
-            setText(QString::number(key - Qt::Key_0));
-        }
-        return;
-    }
-    
-    // ------------------------------------------------------
-    // Handle delete keys
-    // ------------------------------------------------------
-    if (key == Qt::Key_Backspace || key == Qt::Key_Delete) {
-        if (!m_initial) {
-            clear();
-        }
-        return;
-    }
-    
-    // ------------------------------------------------------
-    // Handle arrow key navigation
-    // ------------------------------------------------------
-    if (key == Qt::Key_Up || key == Qt::Key_Down || 
-        key == Qt::Key_Left || key == Qt::Key_Right) {
-        QLineEdit::keyPressEvent(event);
-        return;
-    }
-    
-    // ------------------------------------------------------
-    // Block all other input
-    // ------------------------------------------------------
-    event->ignore();
-}
-
-void SudokuCell::updateDisplay()
-{
-    // Show available moves only if cell is empty and pencil marks are enabled
-    if (text().isEmpty() && m_showPencilMarks) {
-        QString grid;
-        for (int row = 0; row < 3; ++row) {
-            for (int col = 0; col < 3; ++col) {
-                int num = row * 3 + col + 1;
-                if (m_availableMoves.count(num)) {
-                    grid += QString::number(num);
-                } else {
-                    grid += "·";  // Use middle dot for unavailable positions 
-                }
-                if (col < 2) grid += " ";
-            }
-            if (row < 2) grid += "\n";
-        }
-        m_gridLabel->setText(grid);
-        m_gridLabel->show();
-    } else {
-        m_gridLabel->hide();
-    }
-}
-
-void SudokuCell::setPencilMarksVisible(bool visible)
-{
-    m_showPencilMarks = visible;
-    updateDisplay();
-}
-
-void SudokuCell::updateAvailableMoves(const std::set<int>& availableMoves)
-{
-    m_availableMoves = availableMoves;
-    updateDisplay();
-}
-
-void SudokuCell::updateStyle()
-{
-    // ------------------------------------------------------
-    // Set base colors
-    // ------------------------------------------------------
-    QString bgColor = "#2d3436";
-    QString textColor = "#dfe6e9";
-    QString borderColor = "#636e72";
-    
-    if (m_initial) {
-        textColor = "#74b9ff";
-        bgColor = "#2d3436";
-    }
-    
-    if (m_highlighted) {
-        bgColor = "#3d4448";
-    }
-    
-    if (m_matchingNumber) {
-        bgColor = "#6c5ce7";
-        textColor = "#ffffff";
-    }
-    
-    if (m_selected) {
-        bgColor = "#0984e3";
-        borderColor = "#74b9ff";
-    }
-    
-    if (m_error) {
-        bgColor = "#d63031";
-        textColor = "#ffffff";
-    }
-    
-    // ------------------------------------------------------
-    // Calculate borders for 3x3 box separation
-    // ------------------------------------------------------
-    int topBorder = 1;
-    int leftBorder = 1;
-    int rightBorder = 1;
-    int bottomBorder = 1;
-    
-    if (m_row % 3 == 0) topBorder = 3;
-    if (m_col % 3 == 0) leftBorder = 3;
-    if (m_row == 8) bottomBorder = 3;
-    if (m_col == 8) rightBorder = 3;
-    if ((m_col + 1) % 3 == 0) rightBorder = 2;
-    if ((m_row + 1) % 3 == 0) bottomBorder = 2;
-    
-    // ------------------------------------------------------
-    // Apply stylesheet
-    // ------------------------------------------------------
-    QString style = QString(
-        "SudokuCell {"
-        "   background-color: %1;"
-        "   color: %2;"
-        "   border: none;"
-        "   border-top: %3px solid %6;"
-        "   border-left: %4px solid %6;"
-        "   border-right: %5px solid %6;"
-        "   border-bottom: %7px solid %6;"
-        "   padding: 5px;"
-        "}"
-        "SudokuCell:focus {"
-        "   background-color: %8;"
-        "}"
-    ).arg(bgColor)
-     .arg(textColor)
-     .arg(topBorder)
-     .arg(leftBorder)
-     .arg(rightBorder)
-     .arg(borderColor)
-     .arg(bottomBorder)
-     .arg(m_selected ? bgColor : "#3d4448");
-    
-    setStyleSheet(style);
-}
+// ------------------------------------------------------
+// Animated solve: about 60 frames per second, a few search
+// moves per frame
+// ------------------------------------------------------
+static constexpr int ANIMATION_FRAME_MS = 16;
+static constexpr int ANIMATION_EVENTS_PER_FRAME = 4;
 
 // =================================================
 // SudokuGame Main Window Implementation
@@ -293,19 +35,20 @@ void SudokuCell::updateStyle()
 SudokuGame::SudokuGame(QWidget *parent)
     : QMainWindow(parent)
     , ui(new Ui::SudokuGame)
+    , m_animationTimer(nullptr)
+    , m_boardWidget(nullptr)
     , m_selectedRow(-1)
     , m_selectedCol(-1)
     , m_pencilMarksVisible(false)
+    , m_syncedGeneration(0)
 {
     ui->setupUi(this);
     
     // ------------------------------------------------------
-    // Initialize cell grid
+    // Let the board report conflicts live as the user types
     // ------------------------------------------------------
-    m_cells.resize(9);
-    for (int i = 0; i < 9; ++i) {
-        m_cells[i].resize(9);
-    }
+    m_board.setConflictTracking(true);
+    m_journal.reserve(1024);
     
     // ------------------------------------------------------
     // Setup GUI components
@@ -314,15 +57,31 @@ SudokuGame::SudokuGame(QWidget *parent)
     setupNumberPad();
     connectSignals();
     
+    m_animationTimer = new QTimer(this);
+    connect(m_animationTimer, &QTimer::timeout, this, &SudokuGame::onAnimationTick);
+    
     // ------------------------------------------------------
     // Load initial puzzle
     // ------------------------------------------------------
     loadSamplePuzzle();
     updateStatus("Welcome to Sudoku! Select a cell to begin.");
+    
+    // ------------------------------------------------------
+    // Warm-start the puzzle pool and keep it filled in the background
+    // ------------------------------------------------------
+    m_puzzlePool.loadFromFile(puzzlePoolPath().toStdString());
+    m_puzzlePool.start();
 }
 
 SudokuGame::~SudokuGame()
 {
+    // ------------------------------------------------------
+    // Persist pooled puzzles for the next session
+    // ------------------------------------------------------
+    m_puzzlePool.stop();
+    QDir().mkpath(QFileInfo(puzzlePoolPath()).absolutePath());
+    m_puzzlePool.saveToFile(puzzlePoolPath().toStdString());
+    
     delete ui;
 }
 
@@ -337,18 +96,13 @@ void SudokuGame::setupGrid()
     m_gridLayout->setContentsMargins(0, 0, 0, 0);
     
     // ------------------------------------------------------
-    // Create 9x9 grid of SudokuCell widgets
+    // One painted widget draws and edits all 81 cells
     // ------------------------------------------------------
-    for (int row = 0; row < 9; ++row) {
-        for (int col = 0; col < 9; ++col) {
-            SudokuCell *cell = new SudokuCell(row, col, ui->gridContainer);
-            m_cells[row][col] = cell;
-            m_gridLayout->addWidget(cell, row, col);
-            
-            connect(cell, &SudokuCell::cellSelected, this, &SudokuGame::onCellSelected);
-            connect(cell, &SudokuCell::cellValueChanged, this, &SudokuGame::onCellValueChanged);
-        }
-    }
+    m_boardWidget = new SudokuBoardWidget(ui->gridContainer);
+    m_gridLayout->addWidget(m_boardWidget, 0, 0);
+    
+    connect(m_boardWidget, &SudokuBoardWidget::cellSelected, this, &SudokuGame::onCellSelected);
+    connect(m_boardWidget, &SudokuBoardWidget::cellValueChanged, this, &SudokuGame::onCellValueChanged);
 }
 
 void SudokuGame::setupNumberPad()
@@ -436,8 +190,11 @@ void SudokuGame::connectSignals()
     connect(ui->actionLoad, &QAction::triggered, this, &SudokuGame::onLoadPuzzle);
     connect(ui->actionSave, &QAction::triggered, this, &SudokuGame::onSavePuzzle);
     connect(ui->actionSolve, &QAction::triggered, this, &SudokuGame::onSolve);
+    connect(ui->actionAnimateSolve, &QAction::triggered, this, &SudokuGame::onAnimateSolve);
     connect(ui->actionCheck, &QAction::triggered, this, &SudokuGame::onCheck);
     connect(ui->actionClear, &QAction::triggered, this, &SudokuGame::onClearBoard);
+    connect(ui->actionUndo, &QAction::triggered, this, &SudokuGame::onUndo);
+    connect(ui->actionRedo, &QAction::triggered, this, &SudokuGame::onRedo);
     connect(ui->actionAbout, &QAction::triggered, this, &SudokuGame::onAbout);
     connect(ui->actionExit, &QAction::triggered, this, &QMainWindow::close);
 }
@@ -451,68 +208,91 @@ void SudokuGame::loadSamplePuzzle()
     // ------------------------------------------------------
     // Load the sample puzzle from specification
     // ------------------------------------------------------
-    int puzzle[9][9] = {
-        {5, 3, 0, 0, 7, 0, 0, 0, 0},
-        {6, 0, 0, 1, 9, 5, 0, 0, 0},
-        {0, 9, 8, 0, 0, 0, 0, 6, 0},
-        {8, 0, 0, 0, 6, 0, 0, 0, 3},
-        {4, 0, 0, 8, 0, 3, 0, 0, 1},
-        {7, 0, 0, 0, 2, 0, 0, 0, 6},
-        {0, 6, 0, 0, 0, 0, 2, 8, 0},
-        {0, 0, 0, 4, 1, 9, 0, 0, 5},
-        {0, 0, 0, 0, 8, 0, 0, 7, 9}
-    };
-    
+    loadBundledPuzzle(BUNDLED_SPECIFICATION);
+}
+
+void SudokuGame::loadBundledPuzzle(const SudokuBundledPuzzle& puzzle)
+{
     // ------------------------------------------------------
     // Set board values and mark fixed cells
     // ------------------------------------------------------
     m_board.clearAllFixedMarks();
+    m_board.setBoard(puzzle.givens);
     
     for (int row = 0; row < 9; ++row) {
         for (int col = 0; col < 9; ++col) {
-            m_board.setValue(row, col, puzzle[row][col]);
-            
-            if (puzzle[row][col] != 0) {
+            if (puzzle.givens[row][col] != 0) {
                 m_board.markAsFixed(row, col);
             }
         }
     }
     
+    m_journal.reset(m_board);
     syncBoardToGUI();
 }
 
 void SudokuGame::syncBoardToGUI()
 {
     // ------------------------------------------------------
-    // Sync core board state to GUI cells
+    // The board is authoritative: push only the cells whose
+    // value, fixed mark or conflict state changed
     // ------------------------------------------------------
-    for (int row = 0; row < 9; ++row) {
-        for (int col = 0; col < 9; ++col) {
-            SudokuCell *cell = m_cells[row][col];
-            int value = m_board.getValue(row, col);
-            
-            cell->setError(false);
-            cell->setValue(value);
-            cell->setInitial(m_board.isFixed(row, col));
-        }
+    if (m_board.getGeneration() == m_syncedGeneration) {
+        return;
+    }
+    m_syncedGeneration = m_board.getGeneration();
+    
+    for (const auto &cell : m_board.takeDirtyCells()) {
+        int row = cell.first;
+        int col = cell.second;
+        bool fixed = m_board.isFixed(row, col);
+        
+        m_boardWidget->setError(row, col, m_board.hasConflict(row, col) && !fixed);
+        m_boardWidget->setCell(row, col, m_board.getValue(row, col), fixed);
+    }
+    
+    refreshMatchingCells();
+    
+    if (m_pencilMarksVisible) {
+        refreshPencilMarks();
+    }
+}
+
+void SudokuGame::refreshMatchingCells()
+{
+    // ------------------------------------------------------
+    // Highlight the other cells holding the selected digit,
+    // straight from the board's per-digit index
+    // ------------------------------------------------------
+    if (m_selectedRow < 0 || m_selectedCol < 0) {
+        return;
     }
+    
+    int cell = m_selectedRow * SUDOKU_SIZE + m_selectedCol;
+    SudokuBitboard matching = m_board.getDigitCells(m_board.getValue(m_selectedRow, m_selectedCol));
+    m_boardWidget->setMatchingCells(andNot(matching, SUDOKU_BITBOARDS.cells[cell]));
 }
 
-void SudokuGame::syncGUIToBoard()
+void SudokuGame::refreshPencilMarks()
 {
     // ------------------------------------------------------
-    // Sync GUI cell values to core board
+    // Recalculate candidates and hand them to the board view
     // ------------------------------------------------------
+    m_advancedChecks.calculateCandidates(m_board);
+    
     for (int row = 0; row < 9; ++row) {
         for (int col = 0; col < 9; ++col) {
-            if (!m_board.isFixed(row, col)) {
-                int value = m_cells[row][col]->value();
-                m_board.setValue(row, col, value);
-            }
+            m_boardWidget->setCandidates(row, col, m_advancedChecks.getCandidateMask(row, col));
         }
     }
 }
 
+QString SudokuGame::puzzlePoolPath() const
+{
+    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation)
+           + "/puzzle_pool.txt";
+}
+
 // =================================================
 // Cell Interaction Slots
 // =================================================
@@ -520,42 +300,18 @@ void SudokuGame::syncGUIToBoard()
 void SudokuGame::onCellSelected(int row, int col)
 {
     // ------------------------------------------------------
-    // Clear previous selection
-    // ------------------------------------------------------
-    if (m_selectedRow >= 0 && m_selectedCol >= 0) {
-        m_cells[m_selectedRow][m_selectedCol]->setSelected(false);
-    }
-    
-    clearHighlights();
-    
-    // ------------------------------------------------------
-    // Set new selection
+    // The board view paints the selection with its row, column
+    // and box; matching numbers come from the board's index
     // ------------------------------------------------------
     m_selectedRow = row;
     m_selectedCol = col;
-    
-    m_cells[row][col]->setSelected(true);
-    highlightRelatedCells(row, col);
-    
-    // ------------------------------------------------------
-    // Highlight all cells with the same number (purple glow)
-    // ------------------------------------------------------
-    int selectedValue = m_cells[row][col]->value();
-    if (selectedValue >= 1 && selectedValue <= 9) {
-        for (int r = 0; r < 9; ++r) {
-            for (int c = 0; c < 9; ++c) {
-                if ((r != row || c != col) && m_cells[r][c]->value() == selectedValue) {
-                    m_cells[r][c]->setMatchingNumber(true);
-                }
-            }
-        }
-    }
+    refreshMatchingCells();
     
     // ------------------------------------------------------
     // Update status
     // ------------------------------------------------------
     QString status = QString("Selected cell: Row %1, Column %2").arg(row + 1).arg(col + 1);
-    if (m_cells[row][col]->isInitial()) {
+    if (m_board.isFixed(row, col)) {
         status += " (fixed)";
     }
     updateStatus(status);
@@ -563,45 +319,24 @@ void SudokuGame::onCellSelected(int row, int col)
 
 void SudokuGame::onCellValueChanged(int row, int col, int value)
 {
-    // ------------------------------------------------------
-    // Update board when cell value changes
-    // ------------------------------------------------------
-    if (!m_board.isFixed(row, col)) {
-        m_board.setValue(row, col, value);
-    }
+    stopAnimation();
     
     // ------------------------------------------------------
-    // Update matching number highlights if this is the selected cell
+    // Apply the entry to the board; the view follows the board
     // ------------------------------------------------------
-    if (row == m_selectedRow && col == m_selectedCol) {
-        // Clear previous matching highlights
-        for (int r = 0; r < 9; ++r) {
-            for (int c = 0; c < 9; ++c) {
-                m_cells[r][c]->setMatchingNumber(false);
-            }
-        }
-        
-        // Highlight cells with the new matching number
-        if (value >= 1 && value <= 9) {
-            for (int r = 0; r < 9; ++r) {
-                for (int c = 0; c < 9; ++c) {
-                    if ((r != row || c != col) && m_cells[r][c]->value() == value) {
-                        m_cells[r][c]->setMatchingNumber(true);
-                    }
-                }
-            }
-        }
+    if (m_journal.setValue(m_board, row, col, value, MoveKind::ENTRY)) {
+        syncBoardToGUI();
     }
 }
 
 void SudokuGame::onNumberPadClicked(int number)
 {
+    stopAnimation();
+    
     if (m_selectedRow >= 0 && m_selectedCol >= 0) {
-        SudokuCell *cell = m_cells[m_selectedRow][m_selectedCol];
-        
-        if (!cell->isInitial()) {
-            cell->setValue(number);
-            m_board.setValue(m_selectedRow, m_selectedCol, number);
+        if (!m_board.isFixed(m_selectedRow, m_selectedCol)) {
+            m_journal.setValue(m_board, m_selectedRow, m_selectedCol, number, MoveKind::ENTRY);
+            syncBoardToGUI();
             updateStatus(QString("Placed %1 at Row %2, Column %3")
                         .arg(number).arg(m_selectedRow + 1).arg(m_selectedCol + 1));
         } else {
@@ -618,6 +353,8 @@ void SudokuGame::onNumberPadClicked(int number)
 
 void SudokuGame::onNewGame()
 {
+    stopAnimation();
+    
     // ------------------------------------------------------
     // Get selected difficulty from combo box
     // ------------------------------------------------------
@@ -632,47 +369,49 @@ void SudokuGame::onNewGame()
     }
     
     // ------------------------------------------------------
-    // Generate new puzzle
+    // Take a pre-generated puzzle, generating only if the pool is dry
     // ------------------------------------------------------
     updateStatus("Generating puzzle...");
     
-    if (m_generator.generate(m_board, difficulty)) {
+    if (m_puzzlePool.tryPop(difficulty, m_board) || m_generator.generate(m_board, difficulty)) {
+        m_journal.reset(m_board);
         syncBoardToGUI();
         m_selectedRow = -1;
         m_selectedCol = -1;
         clearHighlights();
         clearErrors();
         
-        // Update pencil marks if they're visible
-        if (m_pencilMarksVisible) {
-            m_advancedChecks.calculateCandidates(m_board);
-            for (int row = 0; row < 9; ++row) {
-                for (int col = 0; col < 9; ++col) {
-                    if (m_cells[row][col]->value() == 0) {
-                        std::set<int> availableMoves = m_advancedChecks.getCandidates(row, col);
-                        m_cells[row][col]->updateAvailableMoves(availableMoves);
-                    }
-                }
-            }
-        }
-        
         QString difficultyName = ui->difficultyCombo->currentText();
         updateStatus(QString("New %1 puzzle generated! Select a cell to begin.").arg(difficultyName));
     } else {
-        loadSamplePuzzle();
-        updateStatus("Failed to generate puzzle. Loaded sample puzzle instead.");
+        // Fall back to a built-in puzzle rated at the chosen difficulty
+        const SudokuBundledPuzzle* fallback = &BUNDLED_SPECIFICATION;
+        for (const SudokuBundledPuzzle& puzzle : SUDOKU_BUNDLED_PUZZLES) {
+            if (puzzle.difficulty == difficulty) {
+                fallback = &puzzle;
+                break;
+            }
+        }
+        
+        loadBundledPuzzle(*fallback);
+        updateStatus(QString("Failed to generate puzzle. Loaded \"%1\" instead.").arg(fallback->name));
     }
 }
 
 void SudokuGame::onLoadPuzzle()
 {
+    stopAnimation();
+    
     QString filename = QFileDialog::getOpenFileName(this, 
         "Load Puzzle", "", "Sudoku Files (*.txt *.sudoku);;All Files (*)");
     
     if (!filename.isEmpty()) {
         if (m_board.loadFromFile(filename.toStdString())) {
+            // A missing or inconsistent history loads as an empty one
+            if (!m_journal.loadFromFile(filename.toStdString(), m_board)) {
+                m_journal.reset(m_board);
+            }
             syncBoardToGUI();
-            clearErrors();
             updateStatus("Puzzle loaded successfully!");
         } else {
             QMessageBox::warning(this, "Load Failed", "Could not load puzzle from file.");
@@ -683,13 +422,13 @@ void SudokuGame::onLoadPuzzle()
 
 void SudokuGame::onSavePuzzle()
 {
+    stopAnimation();
+    
     QString filename = QFileDialog::getSaveFileName(this,
         "Save Puzzle", "", "Sudoku Files (*.txt *.sudoku);;All Files (*)");
     
     if (!filename.isEmpty()) {
-        syncGUIToBoard();
-        
-        if (m_board.saveToFile(filename.toStdString())) {
+        if (m_board.saveToFile(filename.toStdString()) && m_journal.appendToFile(filename.toStdString())) {
             updateStatus("Puzzle saved successfully!");
         } else {
             QMessageBox::warning(this, "Save Failed", "Could not save puzzle to file.");
@@ -700,10 +439,43 @@ void SudokuGame::onSavePuzzle()
 
 void SudokuGame::onSolve()
 {
+    stopAnimation();
+    
     // ------------------------------------------------------
-    // Sync GUI to board before solving
+    // Bundled puzzles were solved when the game was compiled;
+    // use that solution while the entries agree with it
     // ------------------------------------------------------
-    syncGUIToBoard();
+    SudokuGrid givens{};
+    for (int row = 0; row < 9; ++row) {
+        for (int col = 0; col < 9; ++col) {
+            if (m_board.isFixed(row, col)) {
+                givens[row][col] = m_board.getValue(row, col);
+            }
+        }
+    }
+    
+    if (const SudokuBundledPuzzle* bundled = findBundledPuzzle(givens)) {
+        bool consistent = true;
+        for (int row = 0; row < 9 && consistent; ++row) {
+            for (int col = 0; col < 9 && consistent; ++col) {
+                int value = m_board.getValue(row, col);
+                consistent = value == 0 || value == bundled->solution[row][col];
+            }
+        }
+        
+        if (consistent) {
+            SudokuBoard solution;
+            solution.setBoard(bundled->solution);
+            m_journal.applyBoard(m_board, solution, MoveKind::SOLVE);
+            syncBoardToGUI();
+            updateStatus(QString("Puzzle solved (built-in solution for \"%1\")!").arg(bundled->name));
+            
+            QMessageBox::information(this, "Success", 
+                QString("Puzzle solved successfully!\nSolution stored with the game for \"%1\".")
+                    .arg(bundled->name));
+            return;
+        }
+    }
     
     // ------------------------------------------------------
     // Create a copy to solve
@@ -723,15 +495,29 @@ void SudokuGame::onSolve()
     }
     
     // ------------------------------------------------------
-    // Attempt to solve
+    // Attempt to solve: race the solver configurations, the
+    // first one to finish answers; the time limit keeps the
+    // GUI responsive on pathological boards
     // ------------------------------------------------------
-    if (m_solver.solve(solveBoard)) {
-        m_board.copyBoard(solveBoard);
+    SolveLimits limits;
+    limits.timeLimit = std::chrono::milliseconds(2000);
+    
+    SolveResult result = m_solver.solvePortfolio(solveBoard, limits);
+    
+    if (result.status == SolveStatus::SOLVED) {
+        m_journal.applyBoard(m_board, solveBoard, MoveKind::SOLVE);
         syncBoardToGUI();
-        updateStatus(QString("Puzzle solved in %1 steps!").arg(m_solver.getStepCount()));
+        QString strategy = SudokuSolver::strategyName(m_solver.getLastWinner());
+        updateStatus(QString("Puzzle solved in %1 steps (%2)!").arg(m_solver.getStepCount()).arg(strategy));
         
         QMessageBox::information(this, "Success", 
-            QString("Puzzle solved successfully!\nSteps taken: %1").arg(m_solver.getStepCount()));
+            QString("Puzzle solved successfully!\nSteps taken: %1\nSolved by: %2")
+                .arg(m_solver.getStepCount()).arg(strategy));
+    } else if (result.status == SolveStatus::BUDGET_EXHAUSTED) {
+        updateStatus(QString("Solver gave up after %1 steps").arg(result.nodes));
+        QMessageBox::warning(this, "No Answer", 
+            "The solver could not decide this puzzle within its time limit.\n"
+            "Check the entered values for conflicts and try again.");
     } else {
         updateStatus("No solution exists for this puzzle!");
         QMessageBox::warning(this, "No Solution", 
@@ -739,35 +525,72 @@ void SudokuGame::onSolve()
     }
 }
 
-void SudokuGame::onCheck()
+void SudokuGame::onAnimateSolve()
 {
     // ------------------------------------------------------
-    // Sync GUI to board
+    // A second trigger stops the animation
+    // ------------------------------------------------------
+    if (m_animationTimer->isActive()) {
+        stopAnimation();
+        updateStatus("Animation stopped.");
+        return;
+    }
+    
+    // ------------------------------------------------------
+    // The step solver searches its own copy; each frame
+    // mirrors a few of its moves onto the board
     // ------------------------------------------------------
-    syncGUIToBoard();
+    m_animationStart.copyBoard(m_board);
+    m_stepSolver.start(m_board);
+    m_animationTimer->start(ANIMATION_FRAME_MS);
+    updateStatus("Solving step by step... (Animate Solve again to stop)");
+}
+
+void SudokuGame::onAnimationTick()
+{
+    SudokuSolveEvent event;
+    
+    for (int i = 0; i < ANIMATION_EVENTS_PER_FRAME && m_stepSolver.step(event); ++i) {
+        if (event.type == SolveEventType::PLACE || event.type == SolveEventType::BACKTRACK) {
+            m_board.setValue(event.row, event.col, event.type == SolveEventType::PLACE ? event.value : 0);
+            continue;
+        }
+        
+        // ------------------------------------------------------
+        // Finished: a solution is recorded as one undoable move,
+        // a dead end puts the player's board back
+        // ------------------------------------------------------
+        m_animationTimer->stop();
+        m_board.copyBoard(m_animationStart);
+        
+        if (event.type == SolveEventType::SOLVED) {
+            m_journal.applyBoard(m_board, m_stepSolver.getBoard(), MoveKind::SOLVE);
+            updateStatus(QString("Puzzle solved in %1 placements and %2 backtracks!")
+                        .arg(m_stepSolver.getPlacementCount()).arg(m_stepSolver.getBacktrackCount()));
+        } else {
+            updateStatus("No solution exists for this puzzle!");
+        }
+    }
+    
+    syncBoardToGUI();
+}
+
+void SudokuGame::onCheck()
+{
+    stopAnimation();
     
     clearErrors();
     
     // ------------------------------------------------------
-    // Check for errors in current state
+    // Check for errors in current state (single validation pass)
     // ------------------------------------------------------
     bool hasErrors = false;
     
-    for (int row = 0; row < 9; ++row) {
-        for (int col = 0; col < 9; ++col) {
-            int value = m_board.getValue(row, col);
-            
-            if (value != 0 && !m_board.isFixed(row, col)) {
-                // Temporarily clear to check validity
-                m_board.setValue(row, col, 0);
-                bool valid = m_board.isValidPlacement(row, col, value);
-                m_board.setValue(row, col, value);
-                
-                if (!valid) {
-                    m_cells[row][col]->setError(true);
-                    hasErrors = true;
-                }
-            }
+    SudokuValidation validation = m_board.validate();
+    for (const auto &cell : validation.conflictingCells) {
+        if (!m_board.isFixed(cell.first, cell.second)) {
+            m_boardWidget->setError(cell.first, cell.second, true);
+            hasErrors = true;
         }
     }
     
@@ -791,12 +614,12 @@ void SudokuGame::onCheck()
 
 void SudokuGame::onClearCell()
 {
+    stopAnimation();
+    
     if (m_selectedRow >= 0 && m_selectedCol >= 0) {
-        SudokuCell *cell = m_cells[m_selectedRow][m_selectedCol];
-        
-        if (!cell->isInitial()) {
-            cell->clearValue();
-            m_board.setValue(m_selectedRow, m_selectedCol, 0);
+        if (!m_board.isFixed(m_selectedRow, m_selectedCol)) {
+            m_journal.setValue(m_board, m_selectedRow, m_selectedCol, 0, MoveKind::ENTRY);
+            syncBoardToGUI();
             updateStatus(QString("Cleared cell at Row %1, Column %2")
                         .arg(m_selectedRow + 1).arg(m_selectedCol + 1));
         } else {
@@ -809,6 +632,8 @@ void SudokuGame::onClearCell()
 
 void SudokuGame::onClearBoard()
 {
+    stopAnimation();
+    
     // ------------------------------------------------------
     // Ask for confirmation
     // ------------------------------------------------------
@@ -821,45 +646,45 @@ void SudokuGame::onClearBoard()
         // ------------------------------------------------------
         // Clear all non-fixed cells
         // ------------------------------------------------------
-        for (int row = 0; row < 9; ++row) {
-            for (int col = 0; col < 9; ++col) {
-                if (!m_board.isFixed(row, col)) {
-                    m_board.setValue(row, col, 0);
-                    m_cells[row][col]->clearValue();
-                }
-            }
-        }
-        
+        m_journal.clearBoard(m_board);
+        syncBoardToGUI();
         clearErrors();
-        updateStatus("Board cleared! All non-fixed cells have been erased.");
+        updateStatus("Board cleared! All non-fixed cells have been erased (Undo restores them).");
     }
 }
 
 void SudokuGame::onHint()
 {
-    // ------------------------------------------------------
-    // Sync GUI to board
-    // ------------------------------------------------------
-    syncGUIToBoard();
+    stopAnimation();
     
     // ------------------------------------------------------
-    // Find a hint using advanced techniques
+    // Find a hint from the cached logical solve path
     // ------------------------------------------------------
+    int stepsRemaining = m_advancedChecks.getRemainingSteps(m_board);
+    
     SudokuHint hint;
     if (m_advancedChecks.findHint(m_board, hint)) {
         // ------------------------------------------------------
         // Highlight the hint cell
         // ------------------------------------------------------
-        clearHighlights();
-        m_cells[hint.row][hint.col]->setSelected(true);
-        m_cells[hint.row][hint.col]->setFocus();
+        m_boardWidget->selectCell(hint.row, hint.col);
+        m_boardWidget->setFocus();
         
         // ------------------------------------------------------
         // Show hint description
         // ------------------------------------------------------
         QString message = QString::fromStdString(hint.description);
-        message += QString("\n\nCell: Row %1, Column %2\nValue: %3")
-                   .arg(hint.row + 1).arg(hint.col + 1).arg(hint.value);
+        if (hint.value != 0) {
+            message += QString("\n\nCell: Row %1, Column %2\nValue: %3")
+                       .arg(hint.row + 1).arg(hint.col + 1).arg(hint.value);
+        } else {
+            message += "\n\nRemove candidates:";
+            for (const SudokuElimination &elimination : hint.eliminations) {
+                message += QString("\n  %1 from Row %2, Column %3")
+                           .arg(elimination.value).arg(elimination.row + 1).arg(elimination.col + 1);
+            }
+        }
+        message += QString("\n\nLogical steps remaining: %1").arg(stepsRemaining);
         
         QMessageBox::information(this, "Hint", message);
         
@@ -885,29 +710,38 @@ void SudokuGame::onToggleNotes()
     
     // Calculate candidates once using advanced checks
     if (m_pencilMarksVisible) {
-        // Sync GUI values to board first
-        syncGUIToBoard();
-        // Now calculate candidates
-        m_advancedChecks.calculateCandidates(m_board);
+        refreshPencilMarks();
     }
     
-    // Update all cells to show/hide pencil marks
-    for (int row = 0; row < 9; ++row) {
-        for (int col = 0; col < 9; ++col) {
-            SudokuCell* cell = m_cells[row][col];
-            cell->setPencilMarksVisible(m_pencilMarksVisible);
-            
-            // Get available moves from advanced checks for empty cells
-            if (cell->value() == 0 && m_pencilMarksVisible) {
-                std::set<int> availableMoves = m_advancedChecks.getCandidates(row, col);
-                cell->updateAvailableMoves(availableMoves);
-            }
-        }
-    }
+    m_boardWidget->setPencilMarksVisible(m_pencilMarksVisible);
     
     updateStatus(m_pencilMarksVisible ? "Pencil marks enabled" : "Pencil marks disabled");
 }
 
+void SudokuGame::onUndo()
+{
+    stopAnimation();
+    
+    if (m_journal.undo(m_board)) {
+        syncBoardToGUI();
+        updateStatus(QString("Undone (step %1 of %2)").arg(m_journal.getStep()).arg(m_journal.getMoveCount()));
+    } else {
+        updateStatus("Nothing to undo.");
+    }
+}
+
+void SudokuGame::onRedo()
+{
+    stopAnimation();
+    
+    if (m_journal.redo(m_board)) {
+        syncBoardToGUI();
+        updateStatus(QString("Redone (step %1 of %2)").arg(m_journal.getStep()).arg(m_journal.getMoveCount()));
+    } else {
+        updateStatus("Nothing to redo.");
+    }
+}
+
 void SudokuGame::onAbout()
 {
     QMessageBox::about(this, "About Sudoku",
@@ -941,40 +775,11 @@ void SudokuGame::updateStatus(const QString &message)
     ui->statusLabel->setText(message);
 }
 
-void SudokuGame::highlightRelatedCells(int row, int col)
-{
-    // ------------------------------------------------------
-    // Highlight same row and column
-    // ------------------------------------------------------
-    for (int i = 0; i < 9; ++i) {
-        if (i != col) m_cells[row][i]->setHighlighted(true);
-        if (i != row) m_cells[i][col]->setHighlighted(true);
-    }
-    
-    // ------------------------------------------------------
-    // Highlight same 3x3 box
-    // ------------------------------------------------------
-    int boxRow = (row / 3) * 3;
-    int boxCol = (col / 3) * 3;
-    
-    for (int r = boxRow; r < boxRow + 3; ++r) {
-        for (int c = boxCol; c < boxCol + 3; ++c) {
-            if (r != row || c != col) {
-                m_cells[r][c]->setHighlighted(true);
-            }
-        }
-    }
-}
-
 void SudokuGame::clearHighlights()
 {
-    for (int row = 0; row < 9; ++row) {
-        for (int col = 0; col < 9; ++col) {
-            m_cells[row][col]->setHighlighted(false);
-            m_cells[row][col]->setMatchingNumber(false);
-            m_cells[row][col]->setSelected(false);
-        }
-    }
+    m_boardWidget->clearSelection();
+    m_selectedRow = -1;
+    m_selectedCol = -1;
 }
 
 void SudokuGame::showErrors()
@@ -982,11 +787,22 @@ void SudokuGame::showErrors()
     // Implementation moved to onCheck()
 }
 
-void SudokuGame::clearErrors()
+void SudokuGame::stopAnimation()
 {
-    for (int row = 0; row < 9; ++row) {
-        for (int col = 0; col < 9; ++col) {
-            m_cells[row][col]->setError(false);
-        }
+    // ------------------------------------------------------
+    // Abandon an animated solve and restore the board it began on
+    // ------------------------------------------------------
+    if (m_animationTimer == nullptr || !m_animationTimer->isActive()) {
+        return;
     }
+    
+    m_animationTimer->stop();
+    m_board.copyBoard(m_animationStart);
+    syncBoardToGUI();
+}
+
+void SudokuGame::clearErrors()
+{
+    m_boardWidget->clearErrors();
+}
 }
@@ -2,9 +2,9 @@
  * @file SudokuGame.hpp
  * @brief Game logic and Qt GUI integration
  *
- * This header defines the main game window and custom cell widgets for
- * the Qt-based Sudoku application. It integrates the board logic and solver
- * with an interactive visual interface.
+ * This header defines the main game window for the Qt-based Sudoku
+ * application. It integrates the board logic and solver with an interactive
+ * visual interface drawn by SudokuBoardWidget.
  *
  * @author Salah-Eldin Hassen
  * @date December 2025
@@ -18,13 +18,15 @@
 #include "SudokuSolver.hpp"
 #include "SudokuGenerator.hpp"
 #include "SudokuAdvancedChecks.hpp"
+#include "SudokuPuzzlePool.hpp"
+#include "SudokuJournal.hpp"
+#include "SudokuStepSolver.hpp"
+#include "SudokuBoardWidget.hpp"
 #include <QMainWindow>
 #include <QGridLayout>
-#include <QLineEdit>
 #include <QPushButton>
+#include <QTimer>
 #include <QVector>
-#include <QLabel>
-#include <set>
 
 QT_BEGIN_NAMESPACE
 namespace Ui {
@@ -32,76 +34,7 @@ class SudokuGame;
 }
 QT_END_NAMESPACE
 
-// =================================================
-// SudokuCell Class - Custom cell widget
-// =================================================
-
-class SudokuCell : public QLineEdit
-{
-    Q_OBJECT
-
-public:
-    explicit SudokuCell(int row, int col, QWidget *parent = nullptr);
-    
-    // ------------------------------------------------------
-    // Accessors
-    // ------------------------------------------------------
-    int row() const { return m_row; }
-    int col() const { return m_col; }
-    int value() const;
-    
-    // ------------------------------------------------------
-    // State Management
-    // ------------------------------------------------------
-    void setInitial(bool initial);
-    bool isInitial() const { return m_initial; }
-    
-    void setValue(int val);
-    void clearValue();
-    
-    // ------------------------------------------------------
-    // Visual State
-    // ------------------------------------------------------
-    void setHighlighted(bool highlighted);
-    void setMatchingNumber(bool matching);
-    void setError(bool error);
-    void setSelected(bool selected);
-
-signals:
-    void cellSelected(int row, int col);
-    void cellValueChanged(int row, int col, int value);
-
-protected:
-    void focusInEvent(QFocusEvent *event) override;
-    void keyPressEvent(QKeyEvent *event) override;
-
-private:
-    // ------------------------------------------------------
-    // Private Data Members
-    // ------------------------------------------------------
-    int m_row;
-    int m_col;
-    bool m_initial;
-    bool m_highlighted;
-    bool m_matchingNumber;
-    bool m_error;
-    bool m_selected;
-    bool m_showPencilMarks;
-    QLabel *m_gridLabel;
-    
-    // ------------------------------------------------------
-    // Private Methods
-    // ------------------------------------------------------
-    void updateStyle();
-    void updateDisplay();
-    
-public:
-    void setPencilMarksVisible(bool visible);
-    void updateAvailableMoves(const std::set<int>& availableMoves);
-    
-private:
-    std::set<int> m_availableMoves;
-};
+struct SudokuBundledPuzzle;   // SudokuBundledPuzzles.hpp (compile-time solved, kept out of this header)
 
 // =================================================
 // SudokuGame Class - Main game window
@@ -130,11 +63,15 @@ private slots:
     void onLoadPuzzle();
     void onSavePuzzle();
     void onSolve();
+    void onAnimateSolve();
+    void onAnimationTick();
     void onCheck();
     void onClearCell();
     void onClearBoard();
     void onHint();
     void onToggleNotes();
+    void onUndo();
+    void onRedo();
     void onAbout();
 
 private:
@@ -147,14 +84,20 @@ private:
     SudokuSolver m_solver;                            // Solver logic
     SudokuGenerator m_generator;                      // Puzzle generator
     SudokuAdvancedChecks m_advancedChecks;            // Advanced techniques
+    SudokuPuzzlePool m_puzzlePool;                    // Pre-generated puzzles
+    SudokuJournal m_journal;                          // Undo/redo history of m_board
+    SudokuStepSolver m_stepSolver;                    // Resumable search behind Animate Solve
+    SudokuBoard m_animationStart;                     // Board restored when an animation ends
+    QTimer *m_animationTimer;                         // Drives one animation frame per tick
     
-    QVector<QVector<SudokuCell*>> m_cells;            // GUI cells
+    SudokuBoardWidget *m_boardWidget;                 // Painted 9x9 board
     QVector<QPushButton*> m_numberPadButtons;         // Number pad buttons
     QGridLayout *m_gridLayout;                        // Grid layout
     
     int m_selectedRow;                                // Currently selected cell
     int m_selectedCol;
     bool m_pencilMarksVisible;
+    uint32_t m_syncedGeneration;                      // Board generation the view shows
     
     // ------------------------------------------------------
     // Private Setup Methods
@@ -167,15 +110,18 @@ private:
     // Private Game Logic Methods
     // ------------------------------------------------------
     void loadSamplePuzzle();
+    void loadBundledPuzzle(const SudokuBundledPuzzle& puzzle);
     void syncBoardToGUI();
-    void syncGUIToBoard();
+    void refreshMatchingCells();
+    void refreshPencilMarks();
+    QString puzzlePoolPath() const;
     
     // ------------------------------------------------------
     // Private UI Helper Methods
     // ------------------------------------------------------
     void updateStatus(const QString &message);
-    void highlightRelatedCells(int row, int col);
     void clearHighlights();
     void showErrors();
     void clearErrors();
+    void stopAnimation();
 };
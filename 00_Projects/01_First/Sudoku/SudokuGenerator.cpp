@@ -13,24 +13,181 @@
  */
 
 #include "SudokuGenerator.hpp"
-#include <algorithm>
 #include <chrono>
 
+// ------------------------------------------------------
+// Uniqueness checks give up on pathological candidates
+// instead of stalling generation; those count as not unique
+// ------------------------------------------------------
+static constexpr SolveLimits UNIQUENESS_LIMITS{20000, std::chrono::milliseconds(50)};
+
+// ------------------------------------------------------
+// A single removal pass on one grid can stall above the clue
+// target; after this many fresh grids generation gives up
+// ------------------------------------------------------
+static constexpr int UNIQUE_REMOVAL_ATTEMPTS = 20;
+
+// ------------------------------------------------------
+// Variant grids: a few random clues completed by the solver, retried
+// on a dead end; a layout with no grid at all (e.g. a bad jigsaw)
+// fails after the last attempt rather than searching forever
+// ------------------------------------------------------
+static constexpr int VARIANT_SEED_CLUES = 11;
+static constexpr int VARIANT_FILL_ATTEMPTS = 20;
+static constexpr SolveLimits VARIANT_FILL_LIMITS{20000, std::chrono::milliseconds(50)};
+
+// ------------------------------------------------------
+// Killer cages grow from a random cell to 2-5 cells
+// ------------------------------------------------------
+static constexpr int MIN_KILLER_CAGE_SIZE = 2;
+static constexpr int MAX_KILLER_CAGE_SIZE = 5;
+
+// =================================================
+// Seed Grid Library
+// =================================================
+
+// ------------------------------------------------------
+// Valid complete grids; every full grid in TRANSFORM mode is
+// one of these under a random validity-preserving symmetry
+// ------------------------------------------------------
+static constexpr int SEED_GRID_COUNT = 8;
+
+static constexpr std::array<SudokuGrid, SEED_GRID_COUNT> SEED_GRIDS = {{
+    {{
+        {2, 1, 5, 4, 3, 8, 6, 7, 9},
+        {3, 6, 9, 2, 7, 1, 8, 4, 5},
+        {4, 7, 8, 6, 9, 5, 3, 2, 1},
+        {8, 2, 4, 9, 6, 7, 1, 5, 3},
+        {5, 3, 1, 8, 2, 4, 9, 6, 7},
+        {7, 9, 6, 5, 1, 3, 4, 8, 2},
+        {9, 8, 7, 3, 4, 2, 5, 1, 6},
+        {1, 4, 3, 7, 5, 6, 2, 9, 8},
+        {6, 5, 2, 1, 8, 9, 7, 3, 4}
+    }},
+    {{
+        {6, 2, 8, 7, 3, 1, 9, 5, 4},
+        {1, 7, 3, 4, 5, 9, 2, 6, 8},
+        {4, 9, 5, 2, 6, 8, 1, 3, 7},
+        {7, 5, 4, 3, 9, 6, 8, 2, 1},
+        {9, 6, 2, 8, 1, 7, 3, 4, 5},
+        {8, 3, 1, 5, 4, 2, 7, 9, 6},
+        {2, 8, 6, 9, 7, 4, 5, 1, 3},
+        {3, 1, 9, 6, 8, 5, 4, 7, 2},
+        {5, 4, 7, 1, 2, 3, 6, 8, 9}
+    }},
+    {{
+        {4, 8, 6, 5, 1, 2, 9, 7, 3},
+        {5, 7, 2, 4, 3, 9, 8, 1, 6},
+        {1, 9, 3, 8, 6, 7, 5, 2, 4},
+        {2, 4, 7, 6, 8, 3, 1, 9, 5},
+        {3, 5, 9, 1, 2, 4, 6, 8, 7},
+        {8, 6, 1, 7, 9, 5, 3, 4, 2},
+        {7, 1, 4, 3, 5, 8, 2, 6, 9},
+        {6, 2, 5, 9, 4, 1, 7, 3, 8},
+        {9, 3, 8, 2, 7, 6, 4, 5, 1}
+    }},
+    {{
+        {4, 2, 5, 9, 8, 1, 7, 3, 6},
+        {9, 7, 3, 2, 4, 6, 1, 5, 8},
+        {6, 1, 8, 5, 7, 3, 9, 4, 2},
+        {2, 6, 1, 3, 5, 8, 4, 7, 9},
+        {8, 5, 7, 4, 1, 9, 6, 2, 3},
+        {3, 9, 4, 7, 6, 2, 5, 8, 1},
+        {1, 4, 9, 8, 2, 7, 3, 6, 5},
+        {5, 8, 6, 1, 3, 4, 2, 9, 7},
+        {7, 3, 2, 6, 9, 5, 8, 1, 4}
+    }},
+    {{
+        {5, 8, 2, 6, 3, 7, 1, 9, 4},
+        {4, 9, 3, 2, 1, 5, 7, 6, 8},
+        {1, 7, 6, 4, 8, 9, 2, 3, 5},
+        {7, 6, 4, 9, 2, 3, 5, 8, 1},
+        {3, 1, 9, 8, 5, 4, 6, 2, 7},
+        {2, 5, 8, 7, 6, 1, 9, 4, 3},
+        {6, 3, 5, 1, 9, 8, 4, 7, 2},
+        {9, 4, 1, 3, 7, 2, 8, 5, 6},
+        {8, 2, 7, 5, 4, 6, 3, 1, 9}
+    }},
+    {{
+        {4, 8, 9, 3, 7, 5, 1, 2, 6},
+        {6, 3, 5, 1, 8, 2, 9, 4, 7},
+        {2, 1, 7, 9, 6, 4, 3, 8, 5},
+        {8, 5, 2, 4, 3, 6, 7, 1, 9},
+        {3, 4, 6, 7, 1, 9, 2, 5, 8},
+        {9, 7, 1, 2, 5, 8, 6, 3, 4},
+        {7, 6, 3, 8, 4, 1, 5, 9, 2},
+        {1, 9, 8, 5, 2, 7, 4, 6, 3},
+        {5, 2, 4, 6, 9, 3, 8, 7, 1}
+    }},
+    {{
+        {8, 5, 1, 3, 9, 2, 4, 6, 7},
+        {4, 9, 7, 6, 5, 1, 2, 3, 8},
+        {6, 2, 3, 7, 8, 4, 1, 5, 9},
+        {2, 4, 6, 5, 1, 7, 9, 8, 3},
+        {1, 3, 8, 2, 6, 9, 7, 4, 5},
+        {9, 7, 5, 4, 3, 8, 6, 1, 2},
+        {5, 6, 9, 1, 7, 3, 8, 2, 4},
+        {7, 1, 2, 8, 4, 5, 3, 9, 6},
+        {3, 8, 4, 9, 2, 6, 5, 7, 1}
+    }},
+    {{
+        {7, 6, 5, 1, 2, 9, 8, 3, 4},
+        {2, 1, 8, 6, 4, 3, 5, 9, 7},
+        {3, 9, 4, 8, 7, 5, 6, 2, 1},
+        {9, 4, 6, 5, 3, 8, 1, 7, 2},
+        {8, 5, 7, 9, 1, 2, 3, 4, 6},
+        {1, 3, 2, 7, 6, 4, 9, 5, 8},
+        {4, 7, 1, 3, 9, 6, 2, 8, 5},
+        {6, 8, 3, 2, 5, 7, 4, 1, 9},
+        {5, 2, 9, 4, 8, 1, 7, 6, 3}
+    }}
+}};
+
+static constexpr bool isCompleteGrid(const SudokuGrid& grid)
+{
+    for (int unit = 0; unit < SUDOKU_UNITS; ++unit) {
+        int mask = 0;
+        for (uint8_t cell : SUDOKU_TABLES.unitCells[unit]) {
+            mask |= 1 << grid[SUDOKU_TABLES.cellRow[cell]][SUDOKU_TABLES.cellCol[cell]];
+        }
+        if (mask != 0x3FE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static constexpr bool areSeedGridsComplete()
+{
+    for (const SudokuGrid& grid : SEED_GRIDS) {
+        if (!isCompleteGrid(grid)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(areSeedGridsComplete(), "Every seed grid must be a valid solution");
+
 // =================================================
 // Constructor & Destructor
 // =================================================
 
 SudokuGenerator::SudokuGenerator()
-    : m_rng(std::chrono::steady_clock::now().time_since_epoch().count())
-    , m_solver()
-    , m_lastAttempts(0)
+    : SudokuGenerator(static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()))
 {
 }
 
-SudokuGenerator::SudokuGenerator(unsigned int seed)
-    : m_rng(seed)
+SudokuGenerator::SudokuGenerator(uint64_t seed)
+    : m_seed(seed)
+    , m_nextPuzzleIndex(0)
+    , m_lastPuzzleIndex(0)
+    , m_rng(seed, 0)
     , m_solver()
+    , m_sampler()
     , m_lastAttempts(0)
+    , m_fullGridMode(FullGridMode::TRANSFORM)
+    , m_rules()
 {
 }
 
@@ -44,6 +201,18 @@ SudokuGenerator::~SudokuGenerator()
 
 bool SudokuGenerator::generate(SudokuBoard& board, Difficulty difficulty)
 {
+    return generateNumbered(board, difficulty, m_nextPuzzleIndex++);
+}
+
+bool SudokuGenerator::generateNumbered(SudokuBoard& board, Difficulty difficulty, uint64_t puzzleIndex)
+{
+    // ------------------------------------------------------
+    // Puzzle #k draws only from stream (seed, k), so it can be
+    // regenerated on any thread without replaying earlier puzzles
+    // ------------------------------------------------------
+    m_rng = SudokuRandom(m_seed, puzzleIndex);
+    m_lastPuzzleIndex = puzzleIndex;
+    
     int cellsToRemove = getCellsToRemove(difficulty);
     return generateWithClueCount(board, 81 - cellsToRemove);
 }
@@ -59,35 +228,94 @@ bool SudokuGenerator::generateWithClueCount(SudokuBoard& board, int clueCount)
     
     m_lastAttempts = 0;
     int cellsToRemove = 81 - clueCount;
+    bool cellsRemoved = false;
+    
+    for (int attempt = 0; attempt < UNIQUE_REMOVAL_ATTEMPTS && !cellsRemoved; ++attempt) {
+        // ------------------------------------------------------
+        // Phase 1: Generate complete solution
+        // ------------------------------------------------------
+        bool solutionGenerated = generateFullSolution(board);
+        if (!solutionGenerated) {
+            // Try again with fresh start
+            for (int row = 0; row < SUDOKU_SIZE; ++row) {
+                for (int col = 0; col < SUDOKU_SIZE; ++col) {
+                    board.setValue(row, col, 0);
+                }
+            }
+            solutionGenerated = generateFullSolution(board);
+            if (!solutionGenerated) {
+                return false;
+            }
+        }
+        
+        // ------------------------------------------------------
+        // Phase 2: Remove cells, keeping the solution unique
+        // ------------------------------------------------------
+        cellsRemoved = removeCellsKeepingUnique(board, cellsToRemove);
+    }
+    
+    if (!cellsRemoved) {
+        return false;
+    }
     
     // ------------------------------------------------------
-    // Phase 1: Generate complete solution
+    // Mark remaining cells as fixed (the puzzle clues)
     // ------------------------------------------------------
-    bool solutionGenerated = generateFullSolution(board);
-    if (!solutionGenerated) {
-        // Try again with fresh start
-        for (int row = 0; row < SUDOKU_SIZE; ++row) {
-            for (int col = 0; col < SUDOKU_SIZE; ++col) {
-                board.setValue(row, col, 0);
+    board.clearAllFixedMarks();
+    for (int row = 0; row < SUDOKU_SIZE; ++row) {
+        for (int col = 0; col < SUDOKU_SIZE; ++col) {
+            if (board.getValue(row, col) != 0) {
+                board.markAsFixed(row, col);
             }
         }
-        solutionGenerated = generateFullSolution(board);
-        if (!solutionGenerated) {
-            return false;
-        }
     }
     
+    return true;
+}
+
+bool SudokuGenerator::generateFullGrid(SudokuBoard& board)
+{
+    return generateFullSolution(board);
+}
+
+void SudokuGenerator::setRuleSet(const SudokuRuleSet& rules)
+{
+    m_rules = rules;
+    m_solver.setRuleSet(rules);
+}
+
+bool SudokuGenerator::generateKiller(SudokuBoard& board, SudokuRuleSet& killerRules, int clueCount)
+{
+    if (clueCount < 0 || clueCount > 81) {
+        return false;
+    }
+    
+    m_lastAttempts = 0;
+    
     // ------------------------------------------------------
-    // Phase 2: Remove cells
+    // Phase 1: Generate complete solution under the base rules
     // ------------------------------------------------------
-    bool cellsRemoved = removeCells(board, cellsToRemove);
-    if (!cellsRemoved) {
+    if (!generateFullSolution(board)) {
         return false;
     }
     
     // ------------------------------------------------------
-    // Mark remaining cells as fixed (the puzzle clues)
+    // Phase 2: Partition the grid into cages whose sums come
+    // from the solution
     // ------------------------------------------------------
+    SudokuRuleSet rules = m_rules;
+    if (!buildKillerCages(board, rules)) {
+        return false;
+    }
+    
+    // ------------------------------------------------------
+    // Phase 3: Remove clues while the cages keep the solution
+    // unique; cage pruning keeps each check cheap
+    // ------------------------------------------------------
+    m_solver.setRuleSet(rules);
+    removeCellsKeepingUnique(board, 81 - clueCount);
+    m_solver.setRuleSet(m_rules);
+    
     board.clearAllFixedMarks();
     for (int row = 0; row < SUDOKU_SIZE; ++row) {
         for (int col = 0; col < SUDOKU_SIZE; ++col) {
@@ -97,6 +325,7 @@ bool SudokuGenerator::generateWithClueCount(SudokuBoard& board, int clueCount)
         }
     }
     
+    killerRules = rules;
     return true;
 }
 
@@ -107,14 +336,58 @@ bool SudokuGenerator::generateWithClueCount(SudokuBoard& board, int clueCount)
 bool SudokuGenerator::generateFullSolution(SudokuBoard& board)
 {
     // ------------------------------------------------------
-    // Clear board
+    // Pick the base grid: a library seed, or a fresh backtracked
+    // grid so that every essentially different grid can appear.
+    // Backtracking favours some grids over others, so only the
+    // uniform mode samples all solution grids evenly (classic
+    // rules only; variant grids always come from the solver)
+    // ------------------------------------------------------
+    if (!m_rules.isClassic()) {
+        return generateVariantGrid(board);
+    }
+    
+    if (m_fullGridMode == FullGridMode::UNIFORM) {
+        SudokuGrid grid;
+        m_sampler.sampleGrid(grid, m_rng);
+        
+        board.clearAllFixedMarks();
+        board.setBoard(grid);
+        return true;
+    }
+    
+    SudokuGrid seed;
+    
+    if (m_fullGridMode == FullGridMode::BACKTRACKED) {
+        if (!generateBacktrackedGrid(board)) {
+            return false;
+        }
+        seed = board.getBoard();
+    } else {
+        seed = SEED_GRIDS[m_rng.below(SEED_GRID_COUNT)];
+    }
+    
+    // ------------------------------------------------------
+    // Apply a random validity-preserving transformation
+    // ------------------------------------------------------
+    SudokuGrid grid;
+    transformGrid(seed, grid);
+    
+    board.clearAllFixedMarks();
+    board.setBoard(grid);
+    return true;
+}
+
+bool SudokuGenerator::generateBacktrackedGrid(SudokuBoard& board)
+{
+    // ------------------------------------------------------
+    // Clear board (fixed marks first, or old clues would survive)
     // ------------------------------------------------------
+    board.clearAllFixedMarks();
     for (int row = 0; row < SUDOKU_SIZE; ++row) {
         for (int col = 0; col < SUDOKU_SIZE; ++col) {
             board.setValue(row, col, 0);
         }
     }
-    board.clearAllFixedMarks();
     
     // ------------------------------------------------------
     // Fast approach: Fill diagonal 3x3 boxes first (they're independent)
@@ -146,11 +419,8 @@ bool SudokuGenerator::fillBoardRecursive(SudokuBoard& board, int position)
     // ------------------------------------------------------
     // Find next empty cell (skip already filled diagonal boxes)
     // ------------------------------------------------------
-    while (position < 81) {
-        int row = position / SUDOKU_SIZE;
-        int col = position % SUDOKU_SIZE;
-        
-        if (board.getValue(row, col) == 0) {
+    while (position < SUDOKU_CELLS) {
+        if (board.isEmpty(SUDOKU_TABLES.cellRow[position], SUDOKU_TABLES.cellCol[position])) {
             break; // Found empty cell
         }
         position++;
@@ -159,12 +429,12 @@ bool SudokuGenerator::fillBoardRecursive(SudokuBoard& board, int position)
     // ------------------------------------------------------
     // Base case: all cells filled
     // ------------------------------------------------------
-    if (position >= 81) {
+    if (position >= SUDOKU_CELLS) {
         return true;
     }
     
-    int row = position / SUDOKU_SIZE;
-    int col = position % SUDOKU_SIZE;
+    int row = SUDOKU_TABLES.cellRow[position];
+    int col = SUDOKU_TABLES.cellCol[position];
     
     // ------------------------------------------------------
     // Try numbers in random order
@@ -190,6 +460,55 @@ bool SudokuGenerator::fillBoardRecursive(SudokuBoard& board, int position)
     return false;
 }
 
+bool SudokuGenerator::generateVariantGrid(SudokuBoard& board)
+{
+    // ------------------------------------------------------
+    // Variant units are not preserved by the band/stack symmetries,
+    // and the diagonal boxes are no longer independent, so each
+    // grid is found by the solver from a random start
+    // ------------------------------------------------------
+    std::array<int, 81> positions{};
+    
+    for (int attempt = 0; attempt < VARIANT_FILL_ATTEMPTS; ++attempt) {
+        board.clearAllFixedMarks();
+        for (int row = 0; row < SUDOKU_SIZE; ++row) {
+            for (int col = 0; col < SUDOKU_SIZE; ++col) {
+                board.setValue(row, col, 0);
+            }
+        }
+        
+        // ------------------------------------------------------
+        // Random clues, each consistent with those before it
+        // ------------------------------------------------------
+        getRandomCellOrder(positions);
+        
+        for (int i = 0; i < VARIANT_SEED_CLUES; ++i) {
+            int row = SUDOKU_TABLES.cellRow[positions[i]];
+            int col = SUDOKU_TABLES.cellCol[positions[i]];
+            uint16_t mask = m_rules.getCandidateMask(board, row, col);
+            
+            std::array<int, 9> numbers{};
+            getShuffledNumbers(numbers);
+            
+            for (int value : numbers) {
+                if ((mask & (1u << value)) != 0) {
+                    board.setValue(row, col, value);
+                    break;
+                }
+            }
+        }
+        
+        // ------------------------------------------------------
+        // Complete the grid; most starts have many completions
+        // ------------------------------------------------------
+        if (m_solver.solve(board, VARIANT_FILL_LIMITS).status == SolveStatus::SOLVED) {
+            return true;
+        }
+    }
+    
+    return false;
+}
+
 void SudokuGenerator::getShuffledNumbers(std::array<int, 9>& numbers)
 {
     // ------------------------------------------------------
@@ -199,53 +518,169 @@ void SudokuGenerator::getShuffledNumbers(std::array<int, 9>& numbers)
         numbers[i] = i + 1;
     }
     
-    std::shuffle(numbers.begin(), numbers.end(), m_rng);
+    m_rng.shuffle(numbers.begin(), numbers.end());
+}
+
+void SudokuGenerator::transformGrid(const SudokuGrid& seed, SudokuGrid& result)
+{
+    // ------------------------------------------------------
+    // Digit relabeling
+    // ------------------------------------------------------
+    std::array<int, 9> numbers{};
+    getShuffledNumbers(numbers);
+    
+    std::array<int, SUDOKU_SIZE + 1> relabel{};
+    for (int i = 0; i < SUDOKU_SIZE; ++i) {
+        relabel[i + 1] = numbers[i];
+    }
+    
+    // ------------------------------------------------------
+    // Band/stack permutations and row/column permutations
+    // inside each band/stack
+    // ------------------------------------------------------
+    std::array<int, SUDOKU_SIZE> rowMap{};
+    std::array<int, SUDOKU_SIZE> colMap{};
+    std::array<int, 3> bands{};
+    std::array<int, 3> stacks{};
+    std::array<int, 3> inner{};
+    
+    getShuffledTriple(bands);
+    getShuffledTriple(stacks);
+    
+    for (int block = 0; block < 3; ++block) {
+        getShuffledTriple(inner);
+        for (int i = 0; i < 3; ++i) {
+            rowMap[block * 3 + i] = bands[block] * 3 + inner[i];
+        }
+        
+        getShuffledTriple(inner);
+        for (int i = 0; i < 3; ++i) {
+            colMap[block * 3 + i] = stacks[block] * 3 + inner[i];
+        }
+    }
+    
+    // ------------------------------------------------------
+    // Optional transposition
+    // ------------------------------------------------------
+    bool transpose = (m_rng() & 1u) != 0;
+    
+    for (int row = 0; row < SUDOKU_SIZE; ++row) {
+        for (int col = 0; col < SUDOKU_SIZE; ++col) {
+            int value = transpose ? seed[colMap[col]][rowMap[row]]
+                                  : seed[rowMap[row]][colMap[col]];
+            result[row][col] = relabel[value];
+        }
+    }
+}
+
+void SudokuGenerator::getShuffledTriple(std::array<int, 3>& triple)
+{
+    triple = {0, 1, 2};
+    m_rng.shuffle(triple.begin(), triple.end());
 }
 
 // =================================================
 // Private Generation Methods - Cell Removal
 // =================================================
 
-bool SudokuGenerator::removeCells(SudokuBoard& board, int cellsToRemove)
+bool SudokuGenerator::buildKillerCages(const SudokuBoard& solution, SudokuRuleSet& rules)
 {
     // ------------------------------------------------------
-    // Fast removal: remove cells randomly
-    // Since we start with a valid complete solution, removing cells
-    // will always leave a solvable puzzle
+    // Grow each cage from a random uncaged cell through uncaged
+    // orthogonal neighbours holding digits the cage lacks
     // ------------------------------------------------------
     std::array<int, 81> positions{};
     getRandomCellOrder(positions);
     
-    int removed = 0;
-    m_lastAttempts = 0;
+    std::array<bool, SUDOKU_CELLS> caged{};
+    
+    auto valueAt = [&solution](int cell) {
+        return solution.getValue(SUDOKU_TABLES.cellRow[cell], SUDOKU_TABLES.cellCol[cell]);
+    };
     
+    for (int start : positions) {
+        if (caged[start]) {
+            continue;
+        }
+        
+        int size = MIN_KILLER_CAGE_SIZE + static_cast<int>(m_rng.below(MAX_KILLER_CAGE_SIZE - MIN_KILLER_CAGE_SIZE + 1));
+        SudokuBitboard cells = SUDOKU_BITBOARDS.cells[start];
+        uint16_t digits = static_cast<uint16_t>(1u << valueAt(start));
+        int sum = valueAt(start);
+        caged[start] = true;
+        
+        for (int count = 1; count < size; ++count) {
+            std::array<int, MAX_KILLER_CAGE_SIZE * 4> options{};
+            int optionCount = 0;
+            
+            cells.forEachCell([&](int cell) {
+                int row = SUDOKU_TABLES.cellRow[cell];
+                int col = SUDOKU_TABLES.cellCol[cell];
+                int neighbours[4] = {row > 0 ? cell - SUDOKU_SIZE : -1, row < SUDOKU_SIZE - 1 ? cell + SUDOKU_SIZE : -1,
+                                     col > 0 ? cell - 1 : -1, col < SUDOKU_SIZE - 1 ? cell + 1 : -1};
+                
+                for (int neighbour : neighbours) {
+                    if (neighbour >= 0 && !caged[neighbour] && (digits & (1u << valueAt(neighbour))) == 0) {
+                        options[optionCount++] = neighbour;
+                    }
+                }
+            });
+            
+            if (optionCount == 0) {
+                break;
+            }
+            
+            int next = options[m_rng.below(static_cast<uint32_t>(optionCount))];
+            cells |= SUDOKU_BITBOARDS.cells[next];
+            digits |= static_cast<uint16_t>(1u << valueAt(next));
+            sum += valueAt(next);
+            caged[next] = true;
+        }
+        
+        if (!rules.addCage(cells, sum)) {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+bool SudokuGenerator::removeCellsKeepingUnique(SudokuBoard& board, int cellsToRemove)
+{
     // ------------------------------------------------------
-    // Simply remove the requested number of cells
+    // Try every cell once in random order; a removal that admits
+    // a second solution (or exhausts the check) is undone
     // ------------------------------------------------------
+    std::array<int, 81> positions{};
+    getRandomCellOrder(positions);
+    
+    int removed = 0;
+    
     for (int i = 0; i < 81 && removed < cellsToRemove; ++i) {
         m_lastAttempts++;
         
-        int pos = positions[i];
-        int row = pos / SUDOKU_SIZE;
-        int col = pos % SUDOKU_SIZE;
+        int row = SUDOKU_TABLES.cellRow[positions[i]];
+        int col = SUDOKU_TABLES.cellCol[positions[i]];
+        int value = board.getValue(row, col);
         
-        if (board.getValue(row, col) != 0) {
-            board.setValue(row, col, 0);
+        board.setValue(row, col, 0);
+        if (hasUniqueSolution(board)) {
             removed++;
+        } else {
+            board.setValue(row, col, value);
         }
     }
     
-    // Always succeeds - we removed exactly what was requested
     return removed >= cellsToRemove;
 }
 
 bool SudokuGenerator::hasUniqueSolution(const SudokuBoard& board)
 {
     // ------------------------------------------------------
-    // Check if puzzle has exactly one solution
+    // Check if puzzle has exactly one solution, within budget
     // ------------------------------------------------------
-    int solutionCount = m_solver.countSolutions(board, 2);
-    return solutionCount == 1;
+    SolveResult result = m_solver.countSolutions(board, 2, UNIQUENESS_LIMITS);
+    return result.status == SolveStatus::SOLVED && result.solutionCount == 1;
 }
 
 void SudokuGenerator::getRandomCellOrder(std::array<int, 81>& positions)
@@ -257,7 +692,7 @@ void SudokuGenerator::getRandomCellOrder(std::array<int, 81>& positions)
         positions[i] = i;
     }
     
-    std::shuffle(positions.begin(), positions.end(), m_rng);
+    m_rng.shuffle(positions.begin(), positions.end());
 }
 
 // =================================================
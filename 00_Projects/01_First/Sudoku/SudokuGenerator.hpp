@@ -15,8 +15,11 @@
 #pragma once
 
 #include "SudokuBoard.hpp"
-#include "SudokuSolver.hpp"
-#include <random>
+#include "SudokuBitboardSolver.hpp"
+#include "SudokuExactCounter.hpp"
+#include "SudokuRandom.hpp"
+#include "SudokuRuleSet.hpp"
+#include <cstdint>
 
 // =================================================
 // Difficulty Level Enumeration
@@ -29,6 +32,19 @@ enum class Difficulty
     HARD       // 25-29 clues (52-56 cells removed)
 };
 
+// =================================================
+// Full Grid Mode Enumeration
+// =================================================
+
+enum class FullGridMode
+{
+    TRANSFORM,   // Random symmetry of a library seed grid (fast)
+    BACKTRACKED, // Diagonal-box prefill plus randomized backtracking, then a
+                 // random symmetry; any grid can appear, but not uniformly
+    UNIFORM      // Every solution grid equally likely, drawn with the exact
+                 // counter (a few ms per grid; for statistics work)
+};
+
 // =================================================
 // SudokuGenerator Class
 // =================================================
@@ -40,38 +56,77 @@ public:
     // Constructor & Destructor
     // ------------------------------------------------------
     SudokuGenerator();
-    explicit SudokuGenerator(unsigned int seed);
+    explicit SudokuGenerator(uint64_t seed);
     ~SudokuGenerator();
     
     // ------------------------------------------------------
     // Puzzle Generation Methods
     // ------------------------------------------------------
     bool generate(SudokuBoard& board, Difficulty difficulty);
+    bool generateNumbered(SudokuBoard& board, Difficulty difficulty, uint64_t puzzleIndex);
     bool generateWithClueCount(SudokuBoard& board, int clueCount);
     
+    // ------------------------------------------------------
+    // Full Grid Generation
+    // ------------------------------------------------------
+    bool generateFullGrid(SudokuBoard& board);
+    void setFullGridMode(FullGridMode mode) { m_fullGridMode = mode; }
+    FullGridMode getFullGridMode() const { return m_fullGridMode; }
+    
+    // ------------------------------------------------------
+    // Variant Rules (classic by default)
+    // ------------------------------------------------------
+    void setRuleSet(const SudokuRuleSet& rules);
+    const SudokuRuleSet& getRuleSet() const { return m_rules; }
+    
+    // ------------------------------------------------------
+    // Killer Generation (cages drawn over the generator's rules,
+    // which must not have cages of their own)
+    // ------------------------------------------------------
+    bool generateKiller(SudokuBoard& board, SudokuRuleSet& killerRules, int clueCount);
+    
+    // ------------------------------------------------------
+    // Puzzle Checks (counts are cached, so re-checking a puzzle
+    // this generator just produced costs no search)
+    // ------------------------------------------------------
+    bool hasUniqueSolution(const SudokuBoard& board);
+    
     // ------------------------------------------------------
     // Statistics
     // ------------------------------------------------------
     int getLastGenerationAttempts() const { return m_lastAttempts; }
+    uint64_t getSeed() const { return m_seed; }
+    uint64_t getLastPuzzleIndex() const { return m_lastPuzzleIndex; }
     void resetStatistics() { m_lastAttempts = 0; }
 
 private:
     // ------------------------------------------------------
     // Private Data Members
     // ------------------------------------------------------
-    std::mt19937 m_rng;                    // Random number generator
-    SudokuSolver m_solver;                 // Solver for verification
+    uint64_t m_seed;                       // Batch seed shared by all puzzle streams
+    uint64_t m_nextPuzzleIndex;            // Index used by the next generate() call
+    uint64_t m_lastPuzzleIndex;            // Index of the last numbered puzzle
+    SudokuRandom m_rng;                    // Stream of the puzzle being generated
+    SudokuBitboardSolver m_solver;         // Uniqueness checks
+    SudokuExactCounter m_sampler;          // Uniform full grids (FullGridMode::UNIFORM)
     int m_lastAttempts;                    // Track generation attempts
+    FullGridMode m_fullGridMode;           // How complete grids are produced
+    SudokuRuleSet m_rules;                 // Units every grid must satisfy
     
     // ------------------------------------------------------
     // Private Generation Methods
     // ------------------------------------------------------
     bool generateFullSolution(SudokuBoard& board);
+    bool generateBacktrackedGrid(SudokuBoard& board);
     bool fillBoardRecursive(SudokuBoard& board, int position);
+    bool generateVariantGrid(SudokuBoard& board);
     void getShuffledNumbers(std::array<int, 9>& numbers);
     
-    bool removeCells(SudokuBoard& board, int cellsToRemove);
-    bool hasUniqueSolution(const SudokuBoard& board);
+    void transformGrid(const SudokuGrid& seed, SudokuGrid& result);
+    void getShuffledTriple(std::array<int, 3>& triple);
+    
+    bool buildKillerCages(const SudokuBoard& solution, SudokuRuleSet& rules);
+    bool removeCellsKeepingUnique(SudokuBoard& board, int cellsToRemove);
     void getRandomCellOrder(std::array<int, 81>& positions);
     
     // ------------------------------------------------------
@@ -0,0 +1,337 @@
+/**
+ * @file SudokuJournal.cpp
+ * @brief Implementation of the undo/redo move journal
+ *
+ * This file implements move recording with periodic snapshots, group-wise
+ * undo and redo, bounded-cost jumps to any step, and the journal section
+ * appended to saved games.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#include "SudokuJournal.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+// =================================================
+// Constructor & Destructor
+// =================================================
+
+SudokuJournal::SudokuJournal()
+    : m_moves()
+    , m_snapshots()
+    , m_cursor(0)
+{
+    m_snapshots.push_back(Snapshot{});
+}
+
+SudokuJournal::~SudokuJournal()
+{
+}
+
+// =================================================
+// History Setup
+// =================================================
+
+void SudokuJournal::reset(const SudokuBoard& board)
+{
+    m_moves.clear();
+    m_snapshots.clear();
+    m_snapshots.push_back(takeSnapshot(board));
+    m_cursor = 0;
+}
+
+void SudokuJournal::reserve(size_t moves)
+{
+    m_moves.reserve(moves);
+    m_snapshots.reserve(moves / SNAPSHOT_INTERVAL + 1);
+}
+
+// =================================================
+// Recording
+// =================================================
+
+bool SudokuJournal::setValue(SudokuBoard& board, int row, int col, int value, MoveKind kind)
+{
+    if (row < 0 || row >= SUDOKU_SIZE || col < 0 || col >= SUDOKU_SIZE) {
+        return false;
+    }
+    return record(board, row * SUDOKU_SIZE + col, value, kind, false);
+}
+
+bool SudokuJournal::applyBoard(SudokuBoard& board, const SudokuBoard& target, MoveKind kind)
+{
+    bool recorded = false;
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        int value = target.getValue(SUDOKU_TABLES.cellRow[cell], SUDOKU_TABLES.cellCol[cell]);
+        if (record(board, cell, value, kind, recorded)) {
+            recorded = true;
+        }
+    }
+    return recorded;
+}
+
+bool SudokuJournal::clearBoard(SudokuBoard& board)
+{
+    bool recorded = false;
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        if (record(board, cell, 0, MoveKind::CLEAR_BOARD, recorded)) {
+            recorded = true;
+        }
+    }
+    return recorded;
+}
+
+// =================================================
+// Navigation
+// =================================================
+
+bool SudokuJournal::undo(SudokuBoard& board)
+{
+    if (!canUndo()) {
+        return false;
+    }
+
+    // ------------------------------------------------------
+    // Step back over the whole group the last move belongs to
+    // ------------------------------------------------------
+    bool continues = true;
+    while (continues) {
+        const SudokuMove& move = m_moves[--m_cursor];
+        writeCell(board, move.cell, move.oldValue);
+        continues = move.continuesGroup() && m_cursor > 0;
+    }
+    return true;
+}
+
+bool SudokuJournal::redo(SudokuBoard& board)
+{
+    if (!canRedo()) {
+        return false;
+    }
+
+    do {
+        const SudokuMove& move = m_moves[m_cursor++];
+        writeCell(board, move.cell, move.newValue);
+    } while (m_cursor < m_moves.size() && m_moves[m_cursor].continuesGroup());
+
+    return true;
+}
+
+bool SudokuJournal::jumpTo(SudokuBoard& board, size_t step)
+{
+    if (step > m_moves.size()) {
+        return false;
+    }
+
+    // ------------------------------------------------------
+    // Far jumps restore the nearest snapshot at or before the
+    // target first, so at most one interval is replayed
+    // ------------------------------------------------------
+    size_t distance = step > m_cursor ? step - m_cursor : m_cursor - step;
+
+    if (distance > SNAPSHOT_INTERVAL) {
+        size_t snapshot = std::min(step / SNAPSHOT_INTERVAL, m_snapshots.size() - 1);
+        restoreSnapshot(board, m_snapshots[snapshot]);
+        m_cursor = snapshot * SNAPSHOT_INTERVAL;
+    }
+
+    replay(board, step);
+    return true;
+}
+
+// =================================================
+// Saved Games
+// =================================================
+
+bool SudokuJournal::appendToFile(const std::string& filename) const
+{
+    std::ofstream file(filename, std::ios::app);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    // ------------------------------------------------------
+    // Format: "journal <moves> <step>", then one 8-digit hex
+    // word per move (cell, old, new, flags from low to high byte)
+    // ------------------------------------------------------
+    file << "journal " << m_moves.size() << " " << m_cursor << "\n";
+    file << std::hex << std::setfill('0');
+
+    for (size_t i = 0; i < m_moves.size(); ++i) {
+        const SudokuMove& move = m_moves[i];
+        uint32_t word = uint32_t(move.cell) | uint32_t(move.oldValue) << 8 | uint32_t(move.newValue) << 16 |
+                        uint32_t(move.flags) << 24;
+        file << std::setw(8) << word << ((i % 8 == 7 || i + 1 == m_moves.size()) ? "\n" : " ");
+    }
+
+    return static_cast<bool>(file);
+}
+
+bool SudokuJournal::loadFromFile(const std::string& filename, const SudokuBoard& board)
+{
+    reset(board);
+
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    // ------------------------------------------------------
+    // Skip the 81 board values; a file without a journal
+    // section simply has no history
+    // ------------------------------------------------------
+    int value;
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        if (!(file >> value)) {
+            return false;
+        }
+    }
+
+    std::string tag;
+    size_t count = 0;
+    size_t step = 0;
+    if (!(file >> tag) || tag != "journal") {
+        return true;
+    }
+    if (!(file >> count >> step) || step > count) {
+        return false;
+    }
+
+    std::vector<SudokuMove> moves;
+    moves.reserve(count);
+    file >> std::hex;
+
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t word;
+        if (!(file >> word)) {
+            return false;
+        }
+        SudokuMove move{static_cast<uint8_t>(word), static_cast<uint8_t>(word >> 8),
+                        static_cast<uint8_t>(word >> 16), static_cast<uint8_t>(word >> 24)};
+
+        if (move.cell >= SUDOKU_CELLS || move.oldValue > SUDOKU_SIZE || move.newValue > SUDOKU_SIZE ||
+            move.kind() > MoveKind::SOLVE ||
+            board.isFixed(SUDOKU_TABLES.cellRow[move.cell], SUDOKU_TABLES.cellCol[move.cell])) {
+            return false;
+        }
+        moves.push_back(move);
+    }
+
+    // ------------------------------------------------------
+    // Undo the applied moves on a copy of the values to find
+    // step 0; every move must match the board it is undone from
+    // ------------------------------------------------------
+    Snapshot values = takeSnapshot(board);
+
+    for (size_t i = step; i-- > 0;) {
+        if (values[moves[i].cell] != moves[i].newValue) {
+            return false;
+        }
+        values[moves[i].cell] = moves[i].oldValue;
+    }
+
+    // ------------------------------------------------------
+    // Replay everything, redo tail included, to rebuild the
+    // snapshots and check the tail against the board it follows
+    // ------------------------------------------------------
+    std::vector<Snapshot> snapshots;
+    snapshots.reserve(count / SNAPSHOT_INTERVAL + 1);
+
+    for (size_t i = 0; i < count; ++i) {
+        if (i % SNAPSHOT_INTERVAL == 0) {
+            snapshots.push_back(values);
+        }
+        if (values[moves[i].cell] != moves[i].oldValue) {
+            return false;
+        }
+        values[moves[i].cell] = moves[i].newValue;
+    }
+    if (snapshots.empty()) {
+        snapshots.push_back(values);
+    }
+
+    m_moves.swap(moves);
+    m_snapshots.swap(snapshots);
+    m_cursor = step;
+    return true;
+}
+
+// =================================================
+// Private Helper Methods
+// =================================================
+
+bool SudokuJournal::record(SudokuBoard& board, int cell, int value, MoveKind kind, bool continuesGroup)
+{
+    int row = SUDOKU_TABLES.cellRow[cell];
+    int col = SUDOKU_TABLES.cellCol[cell];
+    int oldValue = board.getValue(row, col);
+
+    if (value < 0 || value > SUDOKU_SIZE || value == oldValue || board.isFixed(row, col)) {
+        return false;
+    }
+
+    // ------------------------------------------------------
+    // A new move drops the redo tail and any snapshot past it
+    // ------------------------------------------------------
+    if (m_cursor < m_moves.size()) {
+        m_moves.resize(m_cursor);
+        m_snapshots.resize(m_cursor / SNAPSHOT_INTERVAL + 1);
+    }
+
+    if (m_moves.size() % SNAPSHOT_INTERVAL == 0 && m_snapshots.size() <= m_moves.size() / SNAPSHOT_INTERVAL) {
+        m_snapshots.push_back(takeSnapshot(board));
+    }
+
+    uint8_t flags = static_cast<uint8_t>(kind);
+    if (continuesGroup) {
+        flags |= SudokuMove::CONTINUES_GROUP;
+    }
+    m_moves.push_back(SudokuMove{static_cast<uint8_t>(cell), static_cast<uint8_t>(oldValue),
+                                 static_cast<uint8_t>(value), flags});
+    m_cursor = m_moves.size();
+
+    board.setValue(row, col, value);
+    return true;
+}
+
+void SudokuJournal::replay(SudokuBoard& board, size_t step)
+{
+    while (m_cursor > step) {
+        const SudokuMove& move = m_moves[--m_cursor];
+        writeCell(board, move.cell, move.oldValue);
+    }
+    while (m_cursor < step) {
+        const SudokuMove& move = m_moves[m_cursor++];
+        writeCell(board, move.cell, move.newValue);
+    }
+}
+
+SudokuJournal::Snapshot SudokuJournal::takeSnapshot(const SudokuBoard& board)
+{
+    Snapshot snapshot{};
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        snapshot[cell] = static_cast<uint8_t>(board.getValue(SUDOKU_TABLES.cellRow[cell], SUDOKU_TABLES.cellCol[cell]));
+    }
+    return snapshot;
+}
+
+void SudokuJournal::restoreSnapshot(SudokuBoard& board, const Snapshot& snapshot)
+{
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        writeCell(board, cell, snapshot[cell]);
+    }
+}
+
+void SudokuJournal::writeCell(SudokuBoard& board, int cell, int value)
+{
+    // setValue leaves fixed cells alone and skips unchanged values
+    board.setValue(SUDOKU_TABLES.cellRow[cell], SUDOKU_TABLES.cellCol[cell], value);
+}
@@ -0,0 +1,126 @@
+/**
+ * @file SudokuJournal.hpp
+ * @brief Undo/redo move journal with periodic board snapshots
+ *
+ * This header defines the history of edits made to a board. Every change
+ * is recorded as a 4-byte delta (cell, old value, new value, kind), so
+ * undo and redo only rewrite the cells a move touched. Moves made by one
+ * action (clearing the board, applying a solution) share a group and are
+ * undone together.
+ *
+ * Every SNAPSHOT_INTERVAL moves the journal keeps an 81-byte copy of the
+ * cell values, so jumping to any step restores the nearest snapshot and
+ * replays fewer than SNAPSHOT_INTERVAL deltas, whatever the history length.
+ * Once reserve() has sized the storage, recording does not allocate.
+ *
+ * The journal can be appended to a saved game and read back; loading
+ * checks every delta against the loaded board before accepting it.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#pragma once
+
+#include "SudokuBoard.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// =================================================
+// Move Delta
+// =================================================
+
+enum class MoveKind : uint8_t
+{
+    ENTRY,          // Typed or placed by the player
+    CLEAR_BOARD,    // Part of clearing all entries
+    SOLVE           // Part of applying a solution
+};
+
+struct SudokuMove
+{
+    static constexpr uint8_t KIND_MASK = 0x7F;
+    static constexpr uint8_t CONTINUES_GROUP = 0x80;   // Undone together with the move before it
+
+    uint8_t cell;
+    uint8_t oldValue;
+    uint8_t newValue;
+    uint8_t flags;       // MoveKind in the low bits, CONTINUES_GROUP on top
+
+    MoveKind kind() const { return static_cast<MoveKind>(flags & KIND_MASK); }
+    bool continuesGroup() const { return (flags & CONTINUES_GROUP) != 0; }
+};
+
+static_assert(sizeof(SudokuMove) == 4, "A journal entry is a 4-byte delta");
+
+// =================================================
+// SudokuJournal Class
+// =================================================
+
+class SudokuJournal
+{
+public:
+    static constexpr size_t SNAPSHOT_INTERVAL = 64;   // Moves between snapshots
+
+    // ------------------------------------------------------
+    // Constructor & Destructor
+    // ------------------------------------------------------
+    SudokuJournal();
+    ~SudokuJournal();
+
+    // ------------------------------------------------------
+    // History Setup
+    // ------------------------------------------------------
+    void reset(const SudokuBoard& board);      // Board becomes step 0, history is dropped
+    void reserve(size_t moves);
+
+    // ------------------------------------------------------
+    // Recording (returns false when nothing changed)
+    // ------------------------------------------------------
+    bool setValue(SudokuBoard& board, int row, int col, int value, MoveKind kind);
+    bool applyBoard(SudokuBoard& board, const SudokuBoard& target, MoveKind kind);   // One group
+    bool clearBoard(SudokuBoard& board);                                             // One group
+
+    // ------------------------------------------------------
+    // Navigation (one group per undo/redo)
+    // ------------------------------------------------------
+    bool canUndo() const { return m_cursor > 0; }
+    bool canRedo() const { return m_cursor < m_moves.size(); }
+    bool undo(SudokuBoard& board);
+    bool redo(SudokuBoard& board);
+    bool jumpTo(SudokuBoard& board, size_t step);
+
+    size_t getStep() const { return m_cursor; }          // Moves currently applied
+    size_t getMoveCount() const { return m_moves.size(); }
+    const SudokuMove& getMove(size_t index) const { return m_moves[index]; }
+
+    // ------------------------------------------------------
+    // Saved Games
+    // ------------------------------------------------------
+    bool appendToFile(const std::string& filename) const;
+    bool loadFromFile(const std::string& filename, const SudokuBoard& board);
+
+private:
+    using Snapshot = std::array<uint8_t, SUDOKU_CELLS>;
+
+    // ------------------------------------------------------
+    // Private Data Members
+    // ------------------------------------------------------
+    std::vector<SudokuMove> m_moves;
+    std::vector<Snapshot> m_snapshots;   // [k] = values before move k * SNAPSHOT_INTERVAL
+    size_t m_cursor;                     // Moves applied; the rest can be redone
+
+    // ------------------------------------------------------
+    // Private Helper Methods
+    // ------------------------------------------------------
+    bool record(SudokuBoard& board, int cell, int value, MoveKind kind, bool continuesGroup);
+    void replay(SudokuBoard& board, size_t step);
+    static Snapshot takeSnapshot(const SudokuBoard& board);
+    static void restoreSnapshot(SudokuBoard& board, const Snapshot& snapshot);
+    static void writeCell(SudokuBoard& board, int cell, int value);
+};
@@ -0,0 +1,257 @@
+/**
+ * @file SudokuPuzzlePool.cpp
+ * @brief Implementation of the background puzzle pool
+ *
+ * This file implements the refill worker, the consumer-side access used by
+ * the game window, and the plain-text persistence of pooled puzzles.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#include "SudokuPuzzlePool.hpp"
+#include <fstream>
+#include <sstream>
+
+// =================================================
+// Constructor & Destructor
+// =================================================
+
+SudokuPuzzlePool::SudokuPuzzlePool()
+    : m_queues{}
+    , m_generator()
+    , m_stopRequested(false)
+{
+}
+
+SudokuPuzzlePool::~SudokuPuzzlePool()
+{
+    stop();
+}
+
+// =================================================
+// Background Generation
+// =================================================
+
+void SudokuPuzzlePool::start()
+{
+    if (m_worker.joinable()) {
+        return;
+    }
+
+    m_stopRequested.store(false);
+    m_worker = std::thread(&SudokuPuzzlePool::workerLoop, this);
+}
+
+void SudokuPuzzlePool::stop()
+{
+    if (!m_worker.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_stopRequested.store(true);
+    }
+    m_wakeCondition.notify_one();
+    m_worker.join();
+}
+
+// =================================================
+// Puzzle Access
+// =================================================
+
+bool SudokuPuzzlePool::tryPop(Difficulty difficulty, SudokuBoard& board)
+{
+    SudokuGrid puzzle;
+    if (!m_queues[indexFromDifficulty(difficulty)].pop(puzzle)) {
+        return false;
+    }
+
+    // ------------------------------------------------------
+    // Wake the worker once this level drops below the watermark
+    // ------------------------------------------------------
+    if (getLevel(difficulty) < LOW_WATERMARK) {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_wakeCondition.notify_one();
+    }
+
+    // ------------------------------------------------------
+    // Pooled puzzles store clues only, so every filled cell is fixed
+    // ------------------------------------------------------
+    board.clearAllFixedMarks();
+    board.setBoard(puzzle);
+
+    for (int row = 0; row < SUDOKU_SIZE; ++row) {
+        for (int col = 0; col < SUDOKU_SIZE; ++col) {
+            if (puzzle[row][col] != 0) {
+                board.markAsFixed(row, col);
+            }
+        }
+    }
+
+    return true;
+}
+
+size_t SudokuPuzzlePool::getLevel(Difficulty difficulty) const
+{
+    return m_queues[indexFromDifficulty(difficulty)].size();
+}
+
+// =================================================
+// Persistence
+// =================================================
+
+bool SudokuPuzzlePool::loadFromFile(const std::string& filename)
+{
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    // ------------------------------------------------------
+    // One puzzle per line: difficulty index, then 81 digits
+    // Malformed, inconsistent or non-unique lines are skipped;
+    // extra puzzles are dropped
+    // ------------------------------------------------------
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream iss(line);
+        int level;
+        std::string digits;
+
+        if (!(iss >> level >> digits)) {
+            continue;
+        }
+
+        if (level < 0 || level >= DIFFICULTY_LEVELS || digits.size() != 81) {
+            continue;
+        }
+
+        SudokuGrid puzzle{};
+        bool valid = true;
+
+        for (int i = 0; i < 81 && valid; ++i) {
+            char ch = digits[i];
+            if (ch < '0' || ch > '9') {
+                valid = false;
+            } else {
+                puzzle[i / SUDOKU_SIZE][i % SUDOKU_SIZE] = ch - '0';
+            }
+        }
+
+        if (valid && isPoolable(puzzle)) {
+            m_queues[level].push(puzzle);
+        }
+    }
+
+    file.close();
+    return true;
+}
+
+bool SudokuPuzzlePool::saveToFile(const std::string& filename) const
+{
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    for (int level = 0; level < DIFFICULTY_LEVELS; ++level) {
+        m_queues[level].forEach([&file, level](const SudokuGrid& puzzle) {
+            file << level << " ";
+            for (int row = 0; row < SUDOKU_SIZE; ++row) {
+                for (int col = 0; col < SUDOKU_SIZE; ++col) {
+                    file << puzzle[row][col];
+                }
+            }
+            file << "\n";
+        });
+    }
+
+    file.close();
+    return true;
+}
+
+// =================================================
+// Private Helper Methods
+// =================================================
+
+void SudokuPuzzlePool::workerLoop()
+{
+    while (!m_stopRequested.load()) {
+        // ------------------------------------------------------
+        // Top every level up to capacity
+        // ------------------------------------------------------
+        for (int level = 0; level < DIFFICULTY_LEVELS && !m_stopRequested.load(); ++level) {
+            while (m_queues[level].size() < POOL_CAPACITY && !m_stopRequested.load()) {
+                SudokuGrid puzzle;
+                if (generateVerified(difficultyFromIndex(level), puzzle)) {
+                    m_queues[level].push(puzzle);
+                }
+            }
+        }
+
+        // ------------------------------------------------------
+        // Sleep until a level drops below its watermark
+        // ------------------------------------------------------
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        m_wakeCondition.wait(lock, [this]() {
+            return m_stopRequested.load() || needsRefill();
+        });
+    }
+}
+
+bool SudokuPuzzlePool::needsRefill() const
+{
+    for (int level = 0; level < DIFFICULTY_LEVELS; ++level) {
+        if (m_queues[level].size() < LOW_WATERMARK) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SudokuPuzzlePool::generateVerified(Difficulty difficulty, SudokuGrid& puzzle)
+{
+    SudokuBoard board;
+    if (!m_generator.generate(board, difficulty)) {
+        return false;
+    }
+
+    puzzle = board.getBoard();
+    return isPoolable(puzzle);
+}
+
+bool SudokuPuzzlePool::isPoolable(const SudokuGrid& puzzle)
+{
+    SudokuBoard board;
+    board.setBoard(puzzle);
+
+    // ------------------------------------------------------
+    // Only pool puzzles that are consistent and provably have
+    // exactly one solution within the generator's check budget;
+    // for a puzzle the generator just made, its cached count
+    // answers without a search
+    // ------------------------------------------------------
+    return board.isBoardValid() && m_generator.hasUniqueSolution(board);
+}
+
+Difficulty SudokuPuzzlePool::difficultyFromIndex(int index)
+{
+    switch (index) {
+        case 1: return Difficulty::MEDIUM;
+        case 2: return Difficulty::HARD;
+        default: return Difficulty::EASY;
+    }
+}
+
+int SudokuPuzzlePool::indexFromDifficulty(Difficulty difficulty)
+{
+    switch (difficulty) {
+        case Difficulty::MEDIUM: return 1;
+        case Difficulty::HARD: return 2;
+        default: return 0;
+    }
+}
@@ -0,0 +1,158 @@
+/**
+ * @file SudokuPuzzlePool.hpp
+ * @brief Background pool of pre-generated puzzles for instant new games
+ *
+ * This header defines a puzzle pool that keeps a bounded lock-free queue of
+ * verified puzzles per difficulty level. A background thread refills each
+ * queue once it drops below its watermark, and the pool can be persisted to
+ * disk so the next session starts warm.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#pragma once
+
+#include "SudokuBoard.hpp"
+#include "SudokuGenerator.hpp"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// =================================================
+// Pool configuration
+// =================================================
+
+inline constexpr int DIFFICULTY_LEVELS = 3;
+
+// =================================================
+// SudokuPuzzleQueue Class - Bounded SPSC ring buffer
+// =================================================
+
+template <size_t Capacity>
+class SudokuPuzzleQueue
+{
+public:
+    SudokuPuzzleQueue() : m_slots{}, m_head(0), m_tail(0) {}
+
+    // ------------------------------------------------------
+    // Producer side (one thread only)
+    // ------------------------------------------------------
+    bool push(const SudokuGrid& puzzle)
+    {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+
+        m_slots[tail % Capacity] = puzzle;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // ------------------------------------------------------
+    // Consumer side (one thread only)
+    // ------------------------------------------------------
+    bool pop(SudokuGrid& puzzle)
+    {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        puzzle = m_slots[head % Capacity];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // ------------------------------------------------------
+    // Observers
+    // ------------------------------------------------------
+    size_t size() const
+    {
+        // Head first: tail never falls behind a head read before it
+        size_t head = m_head.load(std::memory_order_acquire);
+        return m_tail.load(std::memory_order_acquire) - head;
+    }
+
+    // Only safe while neither side is running (e.g. at shutdown)
+    template <typename Func>
+    void forEach(Func func) const
+    {
+        size_t tail = m_tail.load(std::memory_order_acquire);
+        for (size_t i = m_head.load(std::memory_order_acquire); i != tail; ++i) {
+            func(m_slots[i % Capacity]);
+        }
+    }
+
+private:
+    std::array<SudokuGrid, Capacity> m_slots;
+    std::atomic<size_t> m_head;   // Next slot to pop
+    std::atomic<size_t> m_tail;   // Next slot to push
+};
+
+// =================================================
+// SudokuPuzzlePool Class
+// =================================================
+
+class SudokuPuzzlePool
+{
+public:
+    static constexpr size_t POOL_CAPACITY = 8;   // Puzzles kept per difficulty
+    static constexpr size_t LOW_WATERMARK = 4;   // Refill once a level drops below this
+
+    // ------------------------------------------------------
+    // Constructor & Destructor
+    // ------------------------------------------------------
+    SudokuPuzzlePool();
+    ~SudokuPuzzlePool();
+
+    SudokuPuzzlePool(const SudokuPuzzlePool&) = delete;
+    SudokuPuzzlePool& operator=(const SudokuPuzzlePool&) = delete;
+
+    // ------------------------------------------------------
+    // Background Generation
+    // ------------------------------------------------------
+    void start();
+    void stop();
+
+    // ------------------------------------------------------
+    // Puzzle Access (consumer thread only)
+    // ------------------------------------------------------
+    bool tryPop(Difficulty difficulty, SudokuBoard& board);
+    size_t getLevel(Difficulty difficulty) const;
+
+    // ------------------------------------------------------
+    // Persistence (only while the worker is stopped)
+    // ------------------------------------------------------
+    bool loadFromFile(const std::string& filename);
+    bool saveToFile(const std::string& filename) const;
+
+private:
+    // ------------------------------------------------------
+    // Private Data Members
+    // ------------------------------------------------------
+    std::array<SudokuPuzzleQueue<POOL_CAPACITY>, DIFFICULTY_LEVELS> m_queues;
+    SudokuGenerator m_generator;               // Worker thread, or loading while stopped
+
+    std::thread m_worker;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCondition;
+    std::atomic<bool> m_stopRequested;
+
+    // ------------------------------------------------------
+    // Private Helper Methods
+    // ------------------------------------------------------
+    void workerLoop();
+    bool needsRefill() const;
+    bool generateVerified(Difficulty difficulty, SudokuGrid& puzzle);
+    bool isPoolable(const SudokuGrid& puzzle);
+    static Difficulty difficultyFromIndex(int index);
+    static int indexFromDifficulty(Difficulty difficulty);
+};
@@ -0,0 +1,113 @@
+/**
+ * @file SudokuRandom.hpp
+ * @brief Counter-based, splittable random number streams
+ *
+ * This header defines a SplitMix-style counter-based generator. Output i of
+ * stream (seed, stream) is a pure function of those three numbers, so any
+ * puzzle of a batch can be regenerated from its (seed, index) on any thread
+ * and in any order. Bounded draws and shuffling are implemented here rather
+ * than with <random> distributions, whose results differ between standard
+ * libraries.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+// =================================================
+// SudokuRandom Class
+// =================================================
+
+class SudokuRandom
+{
+public:
+    using result_type = uint64_t;
+
+    // ------------------------------------------------------
+    // Constructors
+    // ------------------------------------------------------
+    SudokuRandom() : SudokuRandom(0, 0) {}
+
+    SudokuRandom(uint64_t seed, uint64_t stream)
+        : m_key(mix(mix(seed) ^ (stream * STREAM_MULTIPLIER + STREAM_INCREMENT)))
+        , m_counter(0)
+    {
+    }
+
+    // ------------------------------------------------------
+    // UniformRandomBitGenerator interface
+    // ------------------------------------------------------
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT64_MAX; }
+
+    result_type operator()()
+    {
+        return mix(m_key + GOLDEN_GAMMA * ++m_counter);
+    }
+
+    // ------------------------------------------------------
+    // Portable helpers
+    // ------------------------------------------------------
+    uint32_t below(uint32_t bound)
+    {
+        // Lemire's multiply-shift with rejection: unbiased in [0, bound)
+        uint64_t product = static_cast<uint64_t>(static_cast<uint32_t>((*this)() >> 32)) * bound;
+        uint32_t low = static_cast<uint32_t>(product);
+
+        if (low < bound) {
+            uint32_t threshold = static_cast<uint32_t>(-bound) % bound;
+            while (low < threshold) {
+                product = static_cast<uint64_t>(static_cast<uint32_t>((*this)() >> 32)) * bound;
+                low = static_cast<uint32_t>(product);
+            }
+        }
+        return static_cast<uint32_t>(product >> 32);
+    }
+
+    uint64_t below64(uint64_t bound)
+    {
+        // Modulo with rejection of the short last block: unbiased in [0, bound)
+        uint64_t threshold = (0 - bound) % bound;
+        uint64_t value = (*this)();
+        while (value < threshold) {
+            value = (*this)();
+        }
+        return value % bound;
+    }
+
+    template <typename RandomIt>
+    void shuffle(RandomIt first, RandomIt last)
+    {
+        // Fisher-Yates, identical on every platform
+        auto count = std::distance(first, last);
+        for (auto i = count - 1; i > 0; --i) {
+            auto j = below(static_cast<uint32_t>(i + 1));
+            std::swap(first[i], first[j]);
+        }
+    }
+
+    uint64_t getCounter() const { return m_counter; }
+
+private:
+    static constexpr uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ull;
+    static constexpr uint64_t STREAM_MULTIPLIER = 0xD1B54A32D192ED03ull;
+    static constexpr uint64_t STREAM_INCREMENT = 0x8BB84B93962EACC9ull;
+
+    uint64_t m_key;       // Derived from (seed, stream)
+    uint64_t m_counter;   // Number of outputs drawn so far
+
+    static constexpr uint64_t mix(uint64_t z)
+    {
+        // SplitMix64 finalizer
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+};
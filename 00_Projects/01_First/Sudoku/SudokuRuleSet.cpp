@@ -0,0 +1,410 @@
+/**
+ * @file SudokuRuleSet.cpp
+ * @brief Implementation of the variant rule sets
+ *
+ * This file implements building rule sets from classic units, diagonals,
+ * windows, irregular regions, Killer cages and a short text form, and
+ * checking boards against any of them.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#include "SudokuRuleSet.hpp"
+#include "SudokuBoard.hpp"
+#include <sstream>
+
+// =================================================
+// Constructor & Destructor
+// =================================================
+
+SudokuRuleSet::SudokuRuleSet()
+    : m_tables()
+{
+}
+
+SudokuRuleSet::~SudokuRuleSet()
+{
+}
+
+// =================================================
+// Building
+// =================================================
+
+void SudokuRuleSet::reset()
+{
+    m_tables.reset();
+}
+
+bool SudokuRuleSet::addDiagonals()
+{
+    return rebuild([](SudokuRuleTables& tables) {
+        std::array<uint8_t, SUDOKU_UNIT_SIZE> mainDiagonal{};
+        std::array<uint8_t, SUDOKU_UNIT_SIZE> antiDiagonal{};
+
+        for (int i = 0; i < SUDOKU_UNIT_SIZE; ++i) {
+            mainDiagonal[i] = static_cast<uint8_t>(i * SUDOKU_UNIT_SIZE + i);
+            antiDiagonal[i] = static_cast<uint8_t>(i * SUDOKU_UNIT_SIZE + SUDOKU_UNIT_SIZE - 1 - i);
+        }
+        return addRuleUnit(tables, SudokuUnitKind::DIAGONAL, 0, mainDiagonal) &&
+               addRuleUnit(tables, SudokuUnitKind::DIAGONAL, 1, antiDiagonal);
+    });
+}
+
+bool SudokuRuleSet::addWindows()
+{
+    return rebuild([](SudokuRuleTables& tables) {
+        // ------------------------------------------------------
+        // Four 3x3 windows with top-left corners at (1,1), (1,5),
+        // (5,1) and (5,5)
+        // ------------------------------------------------------
+        for (int window = 0; window < 4; ++window) {
+            int top = 1 + (window / 2) * 4;
+            int left = 1 + (window % 2) * 4;
+            std::array<uint8_t, SUDOKU_UNIT_SIZE> cells{};
+
+            for (int i = 0; i < SUDOKU_UNIT_SIZE; ++i) {
+                cells[i] = static_cast<uint8_t>((top + i / 3) * SUDOKU_UNIT_SIZE + left + i % 3);
+            }
+            if (!addRuleUnit(tables, SudokuUnitKind::WINDOW, window, cells)) {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+bool SudokuRuleSet::setRegions(const std::array<uint8_t, SUDOKU_CELLS>& regions)
+{
+    // ------------------------------------------------------
+    // Every region must have exactly nine cells
+    // ------------------------------------------------------
+    std::array<std::array<uint8_t, SUDOKU_UNIT_SIZE>, SUDOKU_UNIT_SIZE> regionCells{};
+    std::array<int, SUDOKU_UNIT_SIZE> sizes{};
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        int region = regions[cell];
+        if (region >= SUDOKU_UNIT_SIZE || sizes[region] == SUDOKU_UNIT_SIZE) {
+            return false;
+        }
+        regionCells[region][sizes[region]++] = static_cast<uint8_t>(cell);
+    }
+
+    // ------------------------------------------------------
+    // The regions replace the boxes (or earlier regions); the
+    // remaining units keep their order
+    // ------------------------------------------------------
+    return rebuild([&regionCells](SudokuRuleTables& tables) {
+        SudokuRuleTables kept{};
+
+        for (int unit = 0; unit < tables.unitCount; ++unit) {
+            SudokuUnitKind kind = tables.unitKinds[unit];
+            if (kind != SudokuUnitKind::BOX && kind != SudokuUnitKind::REGION) {
+                addRuleUnit(kept, kind, tables.unitOrdinals[unit], tables.unitCells[unit]);
+            }
+        }
+        for (int region = 0; region < SUDOKU_UNIT_SIZE; ++region) {
+            if (!addRuleUnit(kept, SudokuUnitKind::REGION, region, regionCells[region])) {
+                return false;
+            }
+        }
+
+        kept.cageCount = tables.cageCount;
+        kept.cages = tables.cages;
+        tables = kept;
+        return true;
+    });
+}
+
+bool SudokuRuleSet::addUnit(SudokuUnitKind kind, const std::array<uint8_t, SUDOKU_UNIT_SIZE>& cells)
+{
+    return rebuild([kind, &cells](SudokuRuleTables& tables) {
+        int ordinal = 0;
+        for (int unit = 0; unit < tables.unitCount; ++unit) {
+            ordinal += tables.unitKinds[unit] == kind ? 1 : 0;
+        }
+        return addRuleUnit(tables, kind, ordinal, cells);
+    });
+}
+
+bool SudokuRuleSet::addCage(const SudokuBitboard& cells, int sum)
+{
+    return rebuild([&cells, sum](SudokuRuleTables& tables) {
+        return addRuleCage(tables, cells, sum);
+    });
+}
+
+bool SudokuRuleSet::loadFromString(const std::string& spec)
+{
+    // ------------------------------------------------------
+    // Format: "+"-separated parts applied to classic rules:
+    // "classic", "x" (or "diagonal"), "windoku",
+    // "jigsaw:" followed by 81 region digits 1-9, and
+    // "killer:" followed by ","-separated cages written as
+    // <sum>@<row><col><row><col>... with rows and columns 1-9
+    // ------------------------------------------------------
+    SudokuRuleSet rules;
+    std::istringstream parts(spec);
+    std::string part;
+
+    while (std::getline(parts, part, '+')) {
+        bool ok = false;
+
+        if (part == "classic") {
+            ok = true;
+        } else if (part == "x" || part == "diagonal") {
+            ok = rules.addDiagonals();
+        } else if (part == "windoku") {
+            ok = rules.addWindows();
+        } else if (part.compare(0, 7, "jigsaw:") == 0 && part.size() == 7 + SUDOKU_CELLS) {
+            std::array<uint8_t, SUDOKU_CELLS> regions{};
+            ok = true;
+            for (int cell = 0; cell < SUDOKU_CELLS && ok; ++cell) {
+                char digit = part[7 + cell];
+                ok = digit >= '1' && digit <= '9';
+                regions[cell] = static_cast<uint8_t>(digit - '1');
+            }
+            ok = ok && rules.setRegions(regions);
+        } else if (part.compare(0, 7, "killer:") == 0) {
+            std::istringstream cages(part.substr(7));
+            std::string cage;
+            ok = true;
+
+            while (ok && std::getline(cages, cage, ',')) {
+                size_t at = cage.find('@');
+                ok = at != std::string::npos && at > 0 && at <= 2 && (cage.size() - at - 1) % 2 == 0;
+
+                int sum = 0;
+                for (size_t i = 0; ok && i < at; ++i) {
+                    ok = cage[i] >= '0' && cage[i] <= '9';
+                    sum = sum * 10 + (cage[i] - '0');
+                }
+
+                SudokuBitboard cells{0, 0};
+                for (size_t i = at + 1; ok && i < cage.size(); i += 2) {
+                    ok = cage[i] >= '1' && cage[i] <= '9' && cage[i + 1] >= '1' && cage[i + 1] <= '9';
+                    cells |= SUDOKU_BITBOARDS.cells[(cage[i] - '1') * SUDOKU_SIZE + (cage[i + 1] - '1')];
+                }
+
+                ok = ok && rules.addCage(cells, sum);
+            }
+        }
+
+        if (!ok) {
+            return false;
+        }
+    }
+
+    m_tables = rules.m_tables;
+    return true;
+}
+
+// =================================================
+// Tables
+// =================================================
+
+std::string SudokuRuleSet::getUnitName(int unit) const
+{
+    const SudokuRuleTables& tables = getTables();
+    if (unit < 0 || unit >= tables.unitCount) {
+        return std::string();
+    }
+
+    int ordinal = tables.unitOrdinals[unit];
+    std::ostringstream oss;
+
+    switch (tables.unitKinds[unit]) {
+        case SudokuUnitKind::ROW:
+            oss << "row " << (ordinal + 1);
+            break;
+        case SudokuUnitKind::COLUMN:
+            oss << "column " << (ordinal + 1);
+            break;
+        case SudokuUnitKind::BOX:
+            oss << "box (" << (ordinal / 3 + 1) << "," << (ordinal % 3 + 1) << ")";
+            break;
+        case SudokuUnitKind::DIAGONAL:
+            oss << (ordinal == 0 ? "main diagonal" : "anti-diagonal");
+            break;
+        case SudokuUnitKind::WINDOW:
+            oss << "window " << (ordinal + 1);
+            break;
+        case SudokuUnitKind::REGION:
+            oss << "region " << (ordinal + 1);
+            break;
+    }
+    return oss.str();
+}
+
+std::string SudokuRuleSet::getCageName(int cage) const
+{
+    const SudokuRuleTables& tables = getTables();
+    if (cage < 0 || cage >= tables.cageCount) {
+        return std::string();
+    }
+
+    int first = tables.cages[cage].cells.lowestCell();
+    std::ostringstream oss;
+    oss << static_cast<int>(tables.cages[cage].sum) << "-cage at ("
+        << (SUDOKU_TABLES.cellRow[first] + 1) << "," << (SUDOKU_TABLES.cellCol[first] + 1) << ")";
+    return oss.str();
+}
+
+// =================================================
+// Board Checks
+// =================================================
+
+uint16_t SudokuRuleSet::getCandidateMask(const SudokuBoard& board, int row, int col) const
+{
+    if (isClassic()) {
+        return board.getCandidateMask(row, col);
+    }
+    if (row < 0 || row >= SUDOKU_SIZE || col < 0 || col >= SUDOKU_SIZE) {
+        return 0;
+    }
+
+    // ------------------------------------------------------
+    // Digits held by the cell or any of its peers, as the
+    // board's own mask does for the classic units
+    // ------------------------------------------------------
+    int cell = row * SUDOKU_SIZE + col;
+    uint16_t used = static_cast<uint16_t>(1u << board.getValue(row, col));
+
+    m_tables->peers[cell].forEachCell([&board, &used](int peer) {
+        used |= static_cast<uint16_t>(1u << board.getValue(SUDOKU_TABLES.cellRow[peer], SUDOKU_TABLES.cellCol[peer]));
+    });
+
+    uint16_t mask = static_cast<uint16_t>(~used & 0x3FE);
+
+    // ------------------------------------------------------
+    // A cage cell also needs a digit some sum combination uses
+    // ------------------------------------------------------
+    if (m_tables->cellCages[cell] >= 0 && mask != 0) {
+        mask &= getCageDigits(board, m_tables->cellCages[cell], 0x3FE);
+    }
+    return mask;
+}
+
+bool SudokuRuleSet::isValidPlacement(const SudokuBoard& board, int row, int col, int value) const
+{
+    if (value < 1 || value > SUDOKU_SIZE) {
+        return false;
+    }
+    return (getCandidateMask(board, row, col) & (1u << value)) != 0;
+}
+
+bool SudokuRuleSet::isBoardValid(const SudokuBoard& board) const
+{
+    if (isClassic()) {
+        return board.isBoardValid();
+    }
+
+    // ------------------------------------------------------
+    // No digit twice in any unit
+    // ------------------------------------------------------
+    for (int unit = 0; unit < m_tables->unitCount; ++unit) {
+        uint16_t seen = 0;
+
+        for (uint8_t cell : m_tables->unitCells[unit]) {
+            int value = board.getValue(SUDOKU_TABLES.cellRow[cell], SUDOKU_TABLES.cellCol[cell]);
+            uint16_t bit = static_cast<uint16_t>(1u << value);
+
+            if (value != 0 && (seen & bit) != 0) {
+                return false;
+            }
+            seen |= bit;
+        }
+    }
+
+    // ------------------------------------------------------
+    // No digit twice in a cage, and the sum still reachable (or
+    // met exactly once the cage is full)
+    // ------------------------------------------------------
+    for (int cage = 0; cage < m_tables->cageCount; ++cage) {
+        const SudokuRuleCage& rule = m_tables->cages[cage];
+        uint16_t seen = 0;
+        int total = 0;
+        int filled = 0;
+        bool repeated = false;
+
+        rule.cells.forEachCell([&](int cell) {
+            int value = board.getValue(SUDOKU_TABLES.cellRow[cell], SUDOKU_TABLES.cellCol[cell]);
+            uint16_t bit = static_cast<uint16_t>(1u << value);
+
+            if (value != 0) {
+                repeated = repeated || (seen & bit) != 0;
+                seen |= bit;
+                total += value;
+                ++filled;
+            }
+        });
+
+        if (repeated) {
+            return false;
+        }
+        if (filled == rule.size ? total != rule.sum : getCageDigits(board, cage, 0x3FE) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SudokuRuleSet::isSolved(const SudokuBoard& board) const
+{
+    return board.getFilledCount() == SUDOKU_CELLS && isBoardValid(board);
+}
+
+uint16_t SudokuRuleSet::getCageDigits(const SudokuBoard& board, int cage, uint16_t allowed) const
+{
+    const SudokuRuleTables& tables = getTables();
+    if (cage < 0 || cage >= tables.cageCount) {
+        return 0;
+    }
+
+    // ------------------------------------------------------
+    // What is left of the sum, spread over the empty cells with
+    // digits the cage does not hold yet: one table lookup
+    // ------------------------------------------------------
+    const SudokuRuleCage& rule = tables.cages[cage];
+    uint16_t placed = 0;
+    int remaining = rule.sum;
+    int open = 0;
+
+    rule.cells.forEachCell([&](int cell) {
+        int value = board.getValue(SUDOKU_TABLES.cellRow[cell], SUDOKU_TABLES.cellCol[cell]);
+
+        if (value == 0) {
+            ++open;
+        } else {
+            placed |= static_cast<uint16_t>(1u << value);
+            remaining -= value;
+        }
+    });
+
+    uint16_t digits = cageCombinationDigits(open, remaining, static_cast<uint16_t>((allowed & ~placed) >> 1));
+    return static_cast<uint16_t>(digits << 1);
+}
+
+// =================================================
+// Private Helper Methods
+// =================================================
+
+template <typename Edit>
+bool SudokuRuleSet::rebuild(Edit edit)
+{
+    // ------------------------------------------------------
+    // Edit a private copy and recompile it; copies of this rule
+    // set keep sharing the old tables
+    // ------------------------------------------------------
+    auto tables = std::make_shared<SudokuRuleTables>(getTables());
+
+    if (!edit(*tables)) {
+        return false;
+    }
+
+    compileRuleTables(*tables);
+    m_tables = std::move(tables);
+    return true;
+}
@@ -0,0 +1,323 @@
+/**
+ * @file SudokuRuleSet.hpp
+ * @brief Constraint units of Sudoku variants, compiled into lookup tables
+ *
+ * This header defines the rule set of a puzzle as a list of units: groups
+ * of nine cells that must hold the digits 1-9 once each. Classic Sudoku has
+ * rows, columns and boxes. X-Sudoku adds the two diagonals, Windoku four
+ * extra 3x3 windows, and Jigsaw replaces the boxes with irregular regions.
+ * Killer Sudoku adds cages: groups of cells with distinct digits and a
+ * given sum, pruned through the combination tables of SudokuCageTables.hpp.
+ *
+ * A rule set is compiled once, when it is built or loaded, into the same
+ * kind of tables SudokuBitboard.hpp holds for the classic grid: a bitboard
+ * per unit, the units of every cell, the peers of every cell, and every
+ * pair of units that overlap in two or more cells (the generalised
+ * box/line intersections). The solver, generator and hint engine iterate
+ * these tables instead of naming rows, columns or boxes.
+ *
+ * The classic tables are built at compile time, and SudokuClassicRules
+ * exposes them with constant unit counts, so engines instantiated on it
+ * compile to the same code as before; SudokuVariantRules exposes any
+ * runtime-compiled rule set through the same accessors.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#pragma once
+
+#include "SudokuBitboard.hpp"
+#include "SudokuCageTables.hpp"
+#include "SudokuTables.hpp"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+class SudokuBoard;
+
+// =================================================
+// Table dimensions
+// =================================================
+
+inline constexpr int MAX_RULE_UNITS = 36;   // Classic 27 + 2 diagonals + 4 windows, with room to spare
+inline constexpr int MAX_RULE_INTERSECTIONS = MAX_RULE_UNITS * (MAX_RULE_UNITS - 1) / 2;
+inline constexpr int MAX_RULE_CAGES = SUDOKU_CELLS;   // Cages never overlap
+
+enum class SudokuUnitKind : uint8_t
+{
+    ROW,
+    COLUMN,
+    BOX,
+    DIAGONAL,   // 0 = main diagonal, 1 = anti-diagonal
+    WINDOW,     // Windoku 3x3 window
+    REGION      // Irregular (Jigsaw) region
+};
+
+// =================================================
+// Compiled Tables
+// =================================================
+
+struct SudokuRuleIntersection
+{
+    SudokuBitboard shared;   // Cells in both units
+    uint8_t first;           // Unit indices, first < second
+    uint8_t second;
+};
+
+struct SudokuRuleCage
+{
+    SudokuBitboard cells;
+    uint8_t size;
+    uint8_t sum;
+};
+
+struct SudokuRuleTables
+{
+    int unitCount;
+    int intersectionCount;
+    int cageCount;
+    std::array<SudokuUnitKind, MAX_RULE_UNITS> unitKinds;
+    std::array<uint8_t, MAX_RULE_UNITS> unitOrdinals;                         // Index within its kind
+    std::array<std::array<uint8_t, SUDOKU_UNIT_SIZE>, MAX_RULE_UNITS> unitCells;
+    std::array<SudokuBitboard, MAX_RULE_UNITS> units;
+    std::array<uint64_t, SUDOKU_CELLS> cellUnits;                             // Bit u = cell is in unit u
+    std::array<SudokuBitboard, SUDOKU_CELLS> peers;                           // Cells sharing any unit
+    std::array<SudokuRuleIntersection, MAX_RULE_INTERSECTIONS> intersections;
+    std::array<SudokuRuleCage, MAX_RULE_CAGES> cages;
+    std::array<int8_t, SUDOKU_CELLS> cellCages;                               // Cage of each cell, -1 = none
+};
+
+// ------------------------------------------------------
+// Compilation (constexpr, so the classic tables cost nothing
+// at run time)
+// ------------------------------------------------------
+
+constexpr int countRuleCells(const SudokuBitboard& cells)
+{
+    int count = 0;
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        count += cells.test(cell) ? 1 : 0;
+    }
+    return count;
+}
+
+// False if the table is full or the cells are not nine distinct grid cells
+constexpr bool addRuleUnit(SudokuRuleTables& tables, SudokuUnitKind kind, int ordinal,
+                           const std::array<uint8_t, SUDOKU_UNIT_SIZE>& cells)
+{
+    if (tables.unitCount >= MAX_RULE_UNITS) {
+        return false;
+    }
+
+    SudokuBitboard seen{0, 0};
+    for (uint8_t cell : cells) {
+        if (cell >= SUDOKU_CELLS || seen.test(cell)) {
+            return false;
+        }
+        seen = makeBitboardUnion(seen, SudokuBitboard::fromCell(cell));
+    }
+
+    int unit = tables.unitCount++;
+    tables.unitKinds[unit] = kind;
+    tables.unitOrdinals[unit] = static_cast<uint8_t>(ordinal);
+    tables.unitCells[unit] = cells;
+    return true;
+}
+
+// False if the table is full, the cells overlap another cage or no
+// combination of distinct digits reaches the sum
+constexpr bool addRuleCage(SudokuRuleTables& tables, const SudokuBitboard& cells, int sum)
+{
+    int size = countRuleCells(cells);
+
+    if (tables.cageCount >= MAX_RULE_CAGES || cageCombinationDigits(size, sum, CAGE_ALL_DIGITS) == 0) {
+        return false;
+    }
+
+    for (int cage = 0; cage < tables.cageCount; ++cage) {
+        const SudokuBitboard& other = tables.cages[cage].cells;
+        if ((other.lo & cells.lo) != 0 || (other.hi & cells.hi) != 0) {
+            return false;
+        }
+    }
+
+    tables.cages[tables.cageCount++] = SudokuRuleCage{cells, static_cast<uint8_t>(size), static_cast<uint8_t>(sum)};
+    return true;
+}
+
+constexpr void compileRuleTables(SudokuRuleTables& tables)
+{
+    // ------------------------------------------------------
+    // Unit bitboards and the units of every cell
+    // ------------------------------------------------------
+    tables.cellUnits = {};
+    tables.peers = {};
+
+    for (int unit = 0; unit < tables.unitCount; ++unit) {
+        tables.units[unit] = SudokuBitboard{0, 0};
+
+        for (uint8_t cell : tables.unitCells[unit]) {
+            tables.units[unit] = makeBitboardUnion(tables.units[unit], SudokuBitboard::fromCell(cell));
+            tables.cellUnits[cell] |= uint64_t(1) << unit;
+        }
+    }
+
+    // ------------------------------------------------------
+    // The cage of every cell
+    // ------------------------------------------------------
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        tables.cellCages[cell] = -1;
+
+        for (int cage = 0; cage < tables.cageCount; ++cage) {
+            if (tables.cages[cage].cells.test(cell)) {
+                tables.cellCages[cell] = static_cast<int8_t>(cage);
+            }
+        }
+    }
+
+    // ------------------------------------------------------
+    // Peers: the union of a cell's units and cage (cage digits
+    // never repeat), without the cell
+    // ------------------------------------------------------
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        SudokuBitboard peers{0, 0};
+
+        for (int unit = 0; unit < tables.unitCount; ++unit) {
+            if ((tables.cellUnits[cell] >> unit) & 1) {
+                peers = makeBitboardUnion(peers, tables.units[unit]);
+            }
+        }
+        if (tables.cellCages[cell] >= 0) {
+            peers = makeBitboardUnion(peers, tables.cages[tables.cellCages[cell]].cells);
+        }
+
+        SudokuBitboard self = SudokuBitboard::fromCell(cell);
+        tables.peers[cell] = SudokuBitboard{peers.lo & ~self.lo, peers.hi & ~self.hi};
+    }
+
+    // ------------------------------------------------------
+    // Intersections: unit pairs sharing two or more cells, where
+    // a digit confined to the overlap in one unit leaves the other
+    // ------------------------------------------------------
+    tables.intersectionCount = 0;
+
+    for (int first = 0; first < tables.unitCount; ++first) {
+        for (int second = first + 1; second < tables.unitCount; ++second) {
+            SudokuBitboard shared = {tables.units[first].lo & tables.units[second].lo,
+                                     tables.units[first].hi & tables.units[second].hi};
+
+            if (countRuleCells(shared) >= 2) {
+                tables.intersections[tables.intersectionCount++] =
+                    SudokuRuleIntersection{shared, static_cast<uint8_t>(first), static_cast<uint8_t>(second)};
+            }
+        }
+    }
+}
+
+constexpr SudokuRuleTables makeClassicRuleTables()
+{
+    SudokuRuleTables tables{};
+
+    for (int unit = 0; unit < SUDOKU_UNITS; ++unit) {
+        SudokuUnitKind kind = unit < COL_UNIT_BASE ? SudokuUnitKind::ROW
+                            : unit < BOX_UNIT_BASE ? SudokuUnitKind::COLUMN
+                                                   : SudokuUnitKind::BOX;
+        addRuleUnit(tables, kind, unit % SUDOKU_UNIT_SIZE, SUDOKU_TABLES.unitCells[unit]);
+    }
+
+    compileRuleTables(tables);
+    return tables;
+}
+
+inline constexpr SudokuRuleTables SUDOKU_CLASSIC_RULES = makeClassicRuleTables();
+
+static_assert(SUDOKU_CLASSIC_RULES.unitCount == SUDOKU_UNITS, "Classic rules have 27 units");
+static_assert(SUDOKU_CLASSIC_RULES.intersectionCount == BOX_LINE_INTERSECTIONS, "Only box/line pairs overlap");
+static_assert(SUDOKU_CLASSIC_RULES.cageCount == 0 && SUDOKU_CLASSIC_RULES.cellCages[80] == -1, "No cages");
+static_assert(SUDOKU_CLASSIC_RULES.peers[40].lo == SUDOKU_BITBOARDS.peers[40].lo &&
+              SUDOKU_CLASSIC_RULES.peers[40].hi == SUDOKU_BITBOARDS.peers[40].hi, "Same peers as the classic tables");
+
+// =================================================
+// Rule Views for the Engines
+// =================================================
+
+// Classic tables with compile-time counts and addresses
+struct SudokuClassicRules
+{
+    static constexpr int unitCount() { return SUDOKU_UNITS; }
+    static constexpr int intersectionCount() { return BOX_LINE_INTERSECTIONS; }
+    static constexpr int cageCount() { return 0; }
+    static constexpr const SudokuRuleTables& tables() { return SUDOKU_CLASSIC_RULES; }
+};
+
+// Any compiled rule set, read through a pointer
+struct SudokuVariantRules
+{
+    const SudokuRuleTables* compiled;
+
+    int unitCount() const { return compiled->unitCount; }
+    int intersectionCount() const { return compiled->intersectionCount; }
+    int cageCount() const { return compiled->cageCount; }
+    const SudokuRuleTables& tables() const { return *compiled; }
+};
+
+// =================================================
+// SudokuRuleSet Class
+// =================================================
+
+class SudokuRuleSet
+{
+public:
+    // ------------------------------------------------------
+    // Constructor & Destructor
+    // ------------------------------------------------------
+    SudokuRuleSet();    // Classic rules
+    ~SudokuRuleSet();
+
+    // ------------------------------------------------------
+    // Building (returns false and leaves the rules unchanged
+    // when the result would not be a valid rule set)
+    // ------------------------------------------------------
+    void reset();                                        // Back to classic
+    bool addDiagonals();                                 // X-Sudoku
+    bool addWindows();                                   // Windoku
+    bool setRegions(const std::array<uint8_t, SUDOKU_CELLS>& regions);   // Jigsaw: region 0-8 per cell
+    bool addUnit(SudokuUnitKind kind, const std::array<uint8_t, SUDOKU_UNIT_SIZE>& cells);
+    bool addCage(const SudokuBitboard& cells, int sum);  // Killer: 1-9 cells, distinct digits adding to sum
+    bool loadFromString(const std::string& spec);        // e.g. "x+windoku", "jigsaw:<81 digits>", "killer:<cages>"
+
+    // ------------------------------------------------------
+    // Tables
+    // ------------------------------------------------------
+    bool isClassic() const { return m_tables == nullptr; }
+    const SudokuRuleTables& getTables() const { return m_tables ? *m_tables : SUDOKU_CLASSIC_RULES; }
+    SudokuVariantRules getView() const { return SudokuVariantRules{&getTables()}; }
+    std::string getUnitName(int unit) const;             // "row 3", "box (1,2)", "window 4", ...
+    int getCageCount() const { return getTables().cageCount; }
+    std::string getCageName(int cage) const;             // "15-cage at (1,3)", named by its first cell
+
+    // ------------------------------------------------------
+    // Board Checks (the board's own methods know classic units only)
+    // ------------------------------------------------------
+    uint16_t getCandidateMask(const SudokuBoard& board, int row, int col) const;   // Bit v = digit v
+    bool isValidPlacement(const SudokuBoard& board, int row, int col, int value) const;
+    bool isBoardValid(const SudokuBoard& board) const;
+    bool isSolved(const SudokuBoard& board) const;
+    uint16_t getCageDigits(const SudokuBoard& board, int cage, uint16_t allowed) const;   // Bit v = digit v
+
+private:
+    // ------------------------------------------------------
+    // Private Data Members
+    // ------------------------------------------------------
+    std::shared_ptr<const SudokuRuleTables> m_tables;    // Null = SUDOKU_CLASSIC_RULES; shared by copies
+
+    // ------------------------------------------------------
+    // Private Helper Methods
+    // ------------------------------------------------------
+    template <typename Edit>
+    bool rebuild(Edit edit);
+};
@@ -0,0 +1,106 @@
+/**
+ * @file SudokuSolveLimits.hpp
+ * @brief Node and time budgets for the solvers, with tri-state results
+ *
+ * This header defines the limits a caller can put on a solve or count
+ * (a search-node budget and/or a deadline), the result reported back
+ * (solved, unsolvable, or budget exhausted, plus statistics), and the
+ * small budget tracker both solver engines check on every search node.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// =================================================
+// Limits & Results
+// =================================================
+
+struct SolveLimits
+{
+    uint64_t maxNodes = 0;                     // 0 = no node budget
+    std::chrono::milliseconds timeLimit{0};    // 0 = no deadline
+};
+
+enum class SolveStatus
+{
+    SOLVED,             // A solution was found (count: at least one, search complete)
+    UNSOLVABLE,         // The search finished without a solution
+    BUDGET_EXHAUSTED    // Stopped by a limit or cancelled before an answer
+};
+
+struct SolveResult
+{
+    SolveStatus status = SolveStatus::UNSOLVABLE;
+    int solutionCount = 0;                  // A lower bound when the budget ran out
+    uint64_t nodes = 0;                     // Search steps taken
+    std::chrono::microseconds elapsed{0};
+};
+
+// =================================================
+// SolveBudget Class
+// =================================================
+
+class SolveBudget
+{
+public:
+    static constexpr uint64_t CLOCK_INTERVAL = 256;   // Nodes between deadline checks
+
+    void start(const SolveLimits& limits, const std::atomic<bool>* cancel)
+    {
+        m_startTime = std::chrono::steady_clock::now();
+        m_deadline = m_startTime + limits.timeLimit;
+        m_hasDeadline = limits.timeLimit.count() > 0;
+        m_maxNodes = limits.maxNodes;
+        m_cancel = cancel;
+        m_exhausted = false;
+    }
+
+    // Called before each search node is counted; stays true once a limit is hit
+    bool exhausted(uint64_t nodes)
+    {
+        if (m_exhausted) {
+            return true;
+        }
+
+        if ((m_cancel != nullptr && m_cancel->load(std::memory_order_relaxed)) ||
+            (m_maxNodes != 0 && nodes >= m_maxNodes) ||
+            (m_hasDeadline && nodes % CLOCK_INTERVAL == 0 && std::chrono::steady_clock::now() >= m_deadline)) {
+            m_exhausted = true;
+        }
+        return m_exhausted;
+    }
+
+    bool wasExhausted() const { return m_exhausted; }
+
+    SolveResult finish(int solutionCount, uint64_t nodes) const
+    {
+        SolveResult result;
+        result.solutionCount = solutionCount;
+        result.nodes = nodes;
+        result.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - m_startTime);
+
+        if (m_exhausted) {
+            result.status = SolveStatus::BUDGET_EXHAUSTED;
+        } else {
+            result.status = solutionCount > 0 ? SolveStatus::SOLVED : SolveStatus::UNSOLVABLE;
+        }
+        return result;
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_startTime{};
+    std::chrono::steady_clock::time_point m_deadline{};
+    bool m_hasDeadline = false;
+    uint64_t m_maxNodes = 0;
+    const std::atomic<bool>* m_cancel = nullptr;
+    bool m_exhausted = false;
+};
@@ -4,7 +4,7 @@
  *
  * This file implements the recursive backtracking algorithm for solving
  * Sudoku puzzles, including helper methods for cell searching and
- * solution counting.
+ * solution counting, and the portfolio race between branching strategies.
  *
  * @author Salah-Eldin Hassen
  * @date December 2025
@@ -13,6 +13,16 @@
  */
 
 #include "SudokuSolver.hpp"
+#include "SudokuBitboardSolver.hpp"
+#include <algorithm>
+#include <thread>
+
+namespace
+{
+    constexpr int RESTART_BASE_STEPS = 256;       // Budget of the first restart
+    constexpr int RESTART_DOUBLINGS = 20;         // After this many, run to completion
+    constexpr uint64_t RESTART_SEED = 0x5EED5EEDull;
+}
 
 // =================================================
 // Constructor & Destructor
@@ -20,6 +30,13 @@
 
 SudokuSolver::SudokuSolver()
     : m_stepCount(0)
+    , m_strategy(SolverStrategy::FIRST_EMPTY)
+    , m_cancel(nullptr)
+    , m_restartBudget(0)
+    , m_restartExhausted(false)
+    , m_portfolio{SolverStrategy::BITBOARD, SolverStrategy::MIN_REMAINING,
+                  SolverStrategy::RANDOM_RESTARTS, SolverStrategy::FIRST_EMPTY}
+    , m_lastWinner(SolverStrategy::FIRST_EMPTY)
 {
 }
 
@@ -33,8 +50,7 @@ SudokuSolver::~SudokuSolver()
 
 bool SudokuSolver::solve(SudokuBoard& board)
 {
-    m_stepCount = 0;
-    return solveRecursive(board);
+    return solve(board, SolveLimits{}).status == SolveStatus::SOLVED;
 }
 
 bool SudokuSolver::hasSolution(const SudokuBoard& board)
@@ -49,15 +65,174 @@ bool SudokuSolver::hasSolution(const SudokuBoard& board)
 }
 
 int SudokuSolver::countSolutions(const SudokuBoard& board, int maxCount)
+{
+    return countSolutions(board, maxCount, SolveLimits{}).solutionCount;
+}
+
+// =================================================
+// Budgeted Solving
+// =================================================
+
+SolveResult SudokuSolver::solve(SudokuBoard& board, const SolveLimits& limits)
+{
+    if (m_strategy == SolverStrategy::BITBOARD) {
+        return solveWithBitboard(board, limits);
+    }
+    
+    m_stepCount = 0;
+    m_restartBudget = 0;
+    m_budget.start(limits, m_cancel);
+    
+    bool solved = m_strategy == SolverStrategy::RANDOM_RESTARTS
+                      ? solveWithRestarts(board)
+                      : solveRecursive(board);
+    
+    return m_budget.finish(solved ? 1 : 0, static_cast<uint64_t>(m_stepCount));
+}
+
+SolveResult SudokuSolver::countSolutions(const SudokuBoard& board, int maxCount, const SolveLimits& limits)
 {
     // ------------------------------------------------------
-    // Count number of solutions (useful for puzzle generation)
+    // Count number of solutions (useful for puzzle generation);
+    // a run cut short reports the solutions found so far
     // ------------------------------------------------------
     SudokuBoard tempBoard;
     tempBoard.copyBoard(board);
     
     m_stepCount = 0;
-    return countSolutionsRecursive(tempBoard, maxCount);
+    m_restartBudget = 0;
+    m_budget.start(limits, m_cancel);
+    
+    int solutionCount = countSolutionsRecursive(tempBoard, maxCount);
+    return m_budget.finish(solutionCount, static_cast<uint64_t>(m_stepCount));
+}
+
+SudokuExactCount SudokuSolver::countSolutionsExact(const SudokuBoard& board, const SolveLimits& limits)
+{
+    // ------------------------------------------------------
+    // Band decomposition instead of enumeration: exact counts for
+    // sparse boards, far past what maxCount could cap
+    // ------------------------------------------------------
+    SudokuExactCounter counter;
+    counter.setCancelFlag(m_cancel);
+    
+    return counter.count(board, limits);
+}
+
+// =================================================
+// Configuration
+// =================================================
+
+const char* SudokuSolver::strategyName(SolverStrategy strategy)
+{
+    switch (strategy) {
+    case SolverStrategy::FIRST_EMPTY:
+        return "first empty cell";
+    case SolverStrategy::MIN_REMAINING:
+        return "fewest candidates";
+    case SolverStrategy::RANDOM_RESTARTS:
+        return "randomized restarts";
+    case SolverStrategy::BITBOARD:
+        return "bitboard engine";
+    }
+    return "unknown";
+}
+
+// =================================================
+// Portfolio Mode
+// =================================================
+
+bool SudokuSolver::solvePortfolio(SudokuBoard& board)
+{
+    return solvePortfolio(board, SolveLimits{}).status == SolveStatus::SOLVED;
+}
+
+SolveResult SudokuSolver::solvePortfolio(SudokuBoard& board, const SolveLimits& limits)
+{
+    // ------------------------------------------------------
+    // Race as many configurations as there are hardware threads,
+    // taken from the front of the portfolio order; each entrant
+    // gets the full limits
+    // ------------------------------------------------------
+    size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t count = std::min(m_portfolio.size(), threads);
+    
+    if (count == 0) {
+        return solve(board, limits);
+    }
+    
+    struct Entrant
+    {
+        SudokuSolver solver;
+        SudokuBoard board;
+        SolveResult result;
+    };
+    
+    std::vector<Entrant> entrants(count);
+    std::atomic<bool> cancel{false};
+    std::atomic<int> winner{-1};
+    
+    for (size_t i = 0; i < count; ++i) {
+        entrants[i].solver.setStrategy(m_portfolio[i]);
+        entrants[i].solver.setCancelFlag(&cancel);
+        entrants[i].board.copyBoard(board);
+    }
+    
+    // ------------------------------------------------------
+    // The first entrant to reach an answer claims the win and
+    // cancels the rest; a cancelled or out-of-budget entrant
+    // reports BUDGET_EXHAUSTED and never claims
+    // ------------------------------------------------------
+    auto run = [&](size_t index) {
+        Entrant& entrant = entrants[index];
+        entrant.result = entrant.solver.solve(entrant.board, limits);
+        
+        if (entrant.result.status == SolveStatus::BUDGET_EXHAUSTED) {
+            return;
+        }
+        
+        int expected = -1;
+        if (winner.compare_exchange_strong(expected, static_cast<int>(index))) {
+            cancel.store(true, std::memory_order_relaxed);
+        }
+    };
+    
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < count; ++i) {
+        workers.emplace_back(run, i);
+    }
+    run(0);
+    
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    
+    // ------------------------------------------------------
+    // Record the result and the winning configuration; when every
+    // entrant ran out of budget, report the one that searched most
+    // ------------------------------------------------------
+    m_portfolioStats.races++;
+    
+    int index = winner.load();
+    if (index < 0) {
+        index = 0;
+        for (size_t i = 1; i < count; ++i) {
+            if (entrants[i].result.nodes > entrants[index].result.nodes) {
+                index = static_cast<int>(i);
+            }
+        }
+    } else {
+        m_portfolioStats.wins[static_cast<int>(entrants[index].solver.getStrategy())]++;
+    }
+    
+    const Entrant& best = entrants[index];
+    m_lastWinner = best.solver.getStrategy();
+    m_stepCount = best.solver.getStepCount();
+    
+    if (best.result.status == SolveStatus::SOLVED) {
+        board.copyBoard(best.board);
+    }
+    return best.result;
 }
 
 // =================================================
@@ -66,33 +241,51 @@ int SudokuSolver::countSolutions(const SudokuBoard& board, int maxCount)
 
 bool SudokuSolver::solveRecursive(SudokuBoard& board)
 {
+    if (shouldStop()) {
+        return false;
+    }
+    
     m_stepCount++;
     
     // ------------------------------------------------------
     // Find next empty cell
     // ------------------------------------------------------
     int row, col;
-    if (!findEmptyCell(board, row, col)) {
+    bool found = m_strategy == SolverStrategy::FIRST_EMPTY
+                     ? findEmptyCell(board, row, col)
+                     : findFewestCandidatesCell(board, row, col);
+    if (!found) {
         // No empty cells means puzzle is solved
         return true;
     }
     
     // ------------------------------------------------------
-    // Try values 1-9
+    // Try values 1-9 (shuffled when restarting randomly)
     // ------------------------------------------------------
+    int values[SUDOKU_SIZE];
+    int valueCount = 0;
+    
     for (int value = 1; value <= 9; ++value) {
         if (board.isValidPlacement(row, col, value)) {
-            // Place value
-            board.setValue(row, col, value);
-            
-            // Recursively solve
-            if (solveRecursive(board)) {
-                return true;
-            }
-            
-            // Backtrack if solution not found
-            board.clearValue(row, col);
+            values[valueCount++] = value;
+        }
+    }
+    
+    if (m_strategy == SolverStrategy::RANDOM_RESTARTS) {
+        m_random.shuffle(values, values + valueCount);
+    }
+    
+    for (int i = 0; i < valueCount; ++i) {
+        // Place value
+        board.setValue(row, col, values[i]);
+        
+        // Recursively solve
+        if (solveRecursive(board)) {
+            return true;
         }
+        
+        // Backtrack if solution not found
+        board.clearValue(row, col);
     }
     
     // ------------------------------------------------------
@@ -101,25 +294,107 @@ bool SudokuSolver::solveRecursive(SudokuBoard& board)
     return false;
 }
 
+bool SudokuSolver::solveWithRestarts(SudokuBoard& board)
+{
+    // ------------------------------------------------------
+    // Short randomized searches with doubling step budgets; a bad
+    // early choice costs one budget instead of the whole run. The
+    // last restart has no budget, so the search stays complete.
+    // ------------------------------------------------------
+    for (int restart = 0; ; ++restart) {
+        m_random = SudokuRandom(RESTART_SEED, static_cast<uint64_t>(restart));
+        m_restartBudget = restart < RESTART_DOUBLINGS ? m_stepCount + (RESTART_BASE_STEPS << restart) : 0;
+        m_restartExhausted = false;
+        
+        bool solved = solveRecursive(board);
+        
+        if (solved || !m_restartExhausted) {
+            m_restartBudget = 0;
+            return solved;
+        }
+    }
+}
+
+SolveResult SudokuSolver::solveWithBitboard(SudokuBoard& board, const SolveLimits& limits)
+{
+    SudokuBitboardSolver engine;
+    engine.setCancelFlag(m_cancel);
+    
+    SolveResult result = engine.solve(board, limits);
+    m_stepCount = engine.getStepCount();
+    return result;
+}
+
 bool SudokuSolver::findEmptyCell(const SudokuBoard& board, int& row, int& col)
 {
     // ------------------------------------------------------
     // Find first empty cell (value = 0)
     // ------------------------------------------------------
-    for (int r = 0; r < 9; ++r) {
-        for (int c = 0; c < 9; ++c) {
-            if (board.isEmpty(r, c)) {
-                row = r;
-                col = c;
-                return true;
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        int r = SUDOKU_TABLES.cellRow[cell];
+        int c = SUDOKU_TABLES.cellCol[cell];
+        
+        if (board.isEmpty(r, c)) {
+            row = r;
+            col = c;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SudokuSolver::findFewestCandidatesCell(const SudokuBoard& board, int& row, int& col)
+{
+    // ------------------------------------------------------
+    // Empty cell with the fewest candidates; a cell with none is
+    // returned at once so the caller fails fast
+    // ------------------------------------------------------
+    int bestCount = SUDOKU_SIZE + 1;
+    
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        int r = SUDOKU_TABLES.cellRow[cell];
+        int c = SUDOKU_TABLES.cellCol[cell];
+        
+        if (!board.isEmpty(r, c)) {
+            continue;
+        }
+        
+        uint16_t mask = board.getCandidateMask(r, c);
+        int count = 0;
+        for (; mask != 0; mask &= mask - 1) {
+            ++count;
+        }
+        
+        if (count < bestCount) {
+            bestCount = count;
+            row = r;
+            col = c;
+            if (count <= 1) {
+                break;
             }
         }
     }
+    return bestCount <= SUDOKU_SIZE;
+}
+
+bool SudokuSolver::shouldStop()
+{
+    if (m_budget.exhausted(static_cast<uint64_t>(m_stepCount))) {
+        return true;
+    }
+    if (m_restartBudget != 0 && m_stepCount >= m_restartBudget) {
+        m_restartExhausted = true;
+        return true;
+    }
     return false;
 }
 
 int SudokuSolver::countSolutionsRecursive(SudokuBoard& board, int maxCount)
 {
+    if (shouldStop()) {
+        return 0;
+    }
+    
     m_stepCount++;
     
     // ------------------------------------------------------
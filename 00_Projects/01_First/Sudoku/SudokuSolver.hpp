@@ -6,6 +6,10 @@
  * algorithm to find solutions for Sudoku puzzles. It can solve puzzles,
  * verify solvability, and count possible solutions.
  *
+ * The branching order is configurable, and a portfolio mode races several
+ * configurations on separate threads: the first to finish wins and the
+ * rest are cancelled through a shared flag.
+ *
  * @author Salah-Eldin Hassen
  * @date December 2025
  * @version 1.0
@@ -15,6 +19,37 @@
 #pragma once
 
 #include "SudokuBoard.hpp"
+#include "SudokuExactCounter.hpp"
+#include "SudokuRandom.hpp"
+#include "SudokuSolveLimits.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+// =================================================
+// Solver Configurations
+// =================================================
+
+enum class SolverStrategy
+{
+    FIRST_EMPTY,       // First empty cell in row-major order
+    MIN_REMAINING,     // Empty cell with the fewest candidates (MRV)
+    RANDOM_RESTARTS,   // MRV with shuffled values, restarted with growing budgets
+    BITBOARD           // SudokuBitboardSolver propagation engine
+};
+
+inline constexpr int SOLVER_STRATEGY_COUNT = 4;
+
+struct SudokuPortfolioStats
+{
+    std::array<uint64_t, SOLVER_STRATEGY_COUNT> wins{};   // Races won, by strategy
+    uint64_t races = 0;
+};
+
+// =================================================
+// SudokuSolver Class
+// =================================================
 
 class SudokuSolver
 {
@@ -32,6 +67,35 @@ public:
     bool hasSolution(const SudokuBoard& board);
     int countSolutions(const SudokuBoard& board, int maxCount = 2);
     
+    // ------------------------------------------------------
+    // Budgeted Solving (node budget and/or deadline)
+    // ------------------------------------------------------
+    SolveResult solve(SudokuBoard& board, const SolveLimits& limits);
+    SolveResult countSolutions(const SudokuBoard& board, int maxCount, const SolveLimits& limits);
+    
+    // ------------------------------------------------------
+    // Exact Counting (no maxCount cap; see SudokuExactCounter)
+    // ------------------------------------------------------
+    SudokuExactCount countSolutionsExact(const SudokuBoard& board, const SolveLimits& limits = SolveLimits{});
+    
+    // ------------------------------------------------------
+    // Configuration
+    // ------------------------------------------------------
+    void setStrategy(SolverStrategy strategy) { m_strategy = strategy; }
+    SolverStrategy getStrategy() const { return m_strategy; }
+    void setCancelFlag(const std::atomic<bool>* cancel) { m_cancel = cancel; }
+    static const char* strategyName(SolverStrategy strategy);
+    
+    // ------------------------------------------------------
+    // Portfolio Mode
+    // ------------------------------------------------------
+    bool solvePortfolio(SudokuBoard& board);
+    SolveResult solvePortfolio(SudokuBoard& board, const SolveLimits& limits);
+    void setPortfolio(const std::vector<SolverStrategy>& strategies) { m_portfolio = strategies; }
+    const std::vector<SolverStrategy>& getPortfolio() const { return m_portfolio; }
+    const SudokuPortfolioStats& getPortfolioStats() const { return m_portfolioStats; }
+    SolverStrategy getLastWinner() const { return m_lastWinner; }
+    
     // ------------------------------------------------------
     // Statistics
     // ------------------------------------------------------
@@ -43,12 +107,25 @@ private:
     // Private Data Members
     // ------------------------------------------------------
     int m_stepCount;
+    SolverStrategy m_strategy;
+    const std::atomic<bool>* m_cancel;   // Set by another thread to stop the search
+    SolveBudget m_budget;                // Caller's limits for the current search
+    int m_restartBudget;                 // Step limit of the current restart, 0 = none
+    bool m_restartExhausted;
+    SudokuRandom m_random;
+    
+    std::vector<SolverStrategy> m_portfolio;   // Race order; earlier entries get threads first
+    SudokuPortfolioStats m_portfolioStats;
+    SolverStrategy m_lastWinner;
     
     // ------------------------------------------------------
     // Private Helper Methods
     // ------------------------------------------------------
     bool solveRecursive(SudokuBoard& board);
+    bool solveWithRestarts(SudokuBoard& board);
+    SolveResult solveWithBitboard(SudokuBoard& board, const SolveLimits& limits);
     bool findEmptyCell(const SudokuBoard& board, int& row, int& col);
+    bool findFewestCandidatesCell(const SudokuBoard& board, int& row, int& col);
+    bool shouldStop();
     int countSolutionsRecursive(SudokuBoard& board, int maxCount);
 };
-
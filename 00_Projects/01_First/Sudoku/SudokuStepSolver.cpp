@@ -0,0 +1,166 @@
+/**
+ * @file SudokuStepSolver.cpp
+ * @brief Implementation of the resumable step-wise solver
+ *
+ * This file implements the explicit-stack backtracking search behind
+ * SudokuStepSolver: cell selection, the step state machine and the
+ * sliced advance used to interleave solves.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#include "SudokuStepSolver.hpp"
+#include "SudokuBitboard.hpp"
+
+// =================================================
+// Constructor & Destructor
+// =================================================
+
+SudokuStepSolver::SudokuStepSolver()
+    : m_board()
+    , m_frames{}
+    , m_depth(0)
+    , m_state(State::FINISHED)
+    , m_status(SolveStatus::UNSOLVABLE)
+    , m_strategy(SolverStrategy::MIN_REMAINING)
+    , m_placements(0)
+    , m_backtracks(0)
+{
+}
+
+SudokuStepSolver::~SudokuStepSolver()
+{
+}
+
+// =================================================
+// Stepping
+// =================================================
+
+void SudokuStepSolver::start(const SudokuBoard& board)
+{
+    m_board.copyBoard(board);
+    m_depth = 0;
+    m_status = SolveStatus::BUDGET_EXHAUSTED;
+    m_placements = 0;
+    m_backtracks = 0;
+
+    // A board that already breaks the rules has no solution
+    m_state = m_board.isBoardValid() ? State::DESCEND : State::RESUME;
+}
+
+bool SudokuStepSolver::step(SudokuSolveEvent& event)
+{
+    if (m_state == State::FINISHED) {
+        return false;
+    }
+
+    for (;;) {
+        // ------------------------------------------------------
+        // Descend: open a frame for the next empty cell
+        // ------------------------------------------------------
+        if (m_state == State::DESCEND) {
+            int cell = selectCell();
+            if (cell < 0) {
+                return finish(SolveStatus::SOLVED, event);
+            }
+
+            m_frames[m_depth++] = Frame{static_cast<uint8_t>(cell), 0,
+                                        m_board.getCandidateMask(SUDOKU_TABLES.cellRow[cell],
+                                                                 SUDOKU_TABLES.cellCol[cell])};
+            m_state = State::RESUME;
+        }
+
+        if (m_depth == 0) {
+            return finish(SolveStatus::UNSOLVABLE, event);
+        }
+
+        Frame& frame = m_frames[m_depth - 1];
+        int row = SUDOKU_TABLES.cellRow[frame.cell];
+        int col = SUDOKU_TABLES.cellCol[frame.cell];
+
+        // ------------------------------------------------------
+        // Take back the value that led nowhere
+        // ------------------------------------------------------
+        if (frame.placed != 0) {
+            event = SudokuSolveEvent{SolveEventType::BACKTRACK, row, col, frame.placed};
+            m_board.clearValue(row, col);
+            frame.placed = 0;
+            ++m_backtracks;
+            return true;
+        }
+
+        // ------------------------------------------------------
+        // Try the next candidate, or pop an exhausted frame
+        // ------------------------------------------------------
+        if (frame.remaining != 0) {
+            int value = bitboardLowestBit(frame.remaining);
+            frame.remaining &= static_cast<uint16_t>(frame.remaining - 1);
+            frame.placed = static_cast<uint8_t>(value);
+            m_board.setValue(row, col, value);
+            ++m_placements;
+
+            event = SudokuSolveEvent{SolveEventType::PLACE, row, col, value};
+            m_state = State::DESCEND;
+            return true;
+        }
+
+        --m_depth;
+    }
+}
+
+SolveStatus SudokuStepSolver::advance(uint64_t maxEvents)
+{
+    SudokuSolveEvent event;
+
+    for (uint64_t i = 0; i < maxEvents && step(event); ++i) {
+    }
+    return m_status;
+}
+
+// =================================================
+// Private Helper Methods
+// =================================================
+
+int SudokuStepSolver::selectCell() const
+{
+    // ------------------------------------------------------
+    // Same choices as SudokuSolver: the first empty cell, or the
+    // one with the fewest candidates (a dead cell at once)
+    // ------------------------------------------------------
+    int best = -1;
+    int bestCount = SUDOKU_SIZE + 1;
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        int row = SUDOKU_TABLES.cellRow[cell];
+        int col = SUDOKU_TABLES.cellCol[cell];
+
+        if (!m_board.isEmpty(row, col)) {
+            continue;
+        }
+        if (m_strategy == SolverStrategy::FIRST_EMPTY) {
+            return cell;
+        }
+
+        int count = bitboardPopCount(m_board.getCandidateMask(row, col));
+        if (count < bestCount) {
+            best = cell;
+            bestCount = count;
+            if (count == 0) {
+                break;
+            }
+        }
+    }
+    return best;
+}
+
+bool SudokuStepSolver::finish(SolveStatus status, SudokuSolveEvent& event)
+{
+    event = SudokuSolveEvent{status == SolveStatus::SOLVED ? SolveEventType::SOLVED : SolveEventType::UNSOLVABLE,
+                             -1, -1, 0};
+    m_status = status;
+    m_state = State::FINISHED;
+    return true;
+}
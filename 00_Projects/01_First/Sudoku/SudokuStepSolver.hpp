@@ -0,0 +1,112 @@
+/**
+ * @file SudokuStepSolver.hpp
+ * @brief Resumable backtracking solver that stops after every move
+ *
+ * This header defines a solver that runs the same backtracking search as
+ * SudokuSolver (first empty cell or fewest candidates), but keeps its
+ * search stack in the object instead of on the call stack. Each call to
+ * step() advances the search to the next placement or backtrack, reports
+ * it, and returns, so a caller can animate a solve one move per frame or
+ * interleave many solves on one thread in fixed slices.
+ *
+ * The stack holds one 4-byte frame per empty cell and is part of the
+ * object, so starting, stepping and restarting never allocate; one solver
+ * can be reused for any number of boards.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#pragma once
+
+#include "SudokuBoard.hpp"
+#include "SudokuSolveLimits.hpp"
+#include "SudokuSolver.hpp"
+#include <array>
+#include <cstdint>
+
+// =================================================
+// Solve Events
+// =================================================
+
+enum class SolveEventType
+{
+    PLACE,        // value was written to (row, col)
+    BACKTRACK,    // value was taken back from (row, col)
+    SOLVED,       // The board is complete
+    UNSOLVABLE    // Every branch failed
+};
+
+struct SudokuSolveEvent
+{
+    SolveEventType type = SolveEventType::UNSOLVABLE;
+    int row = -1;
+    int col = -1;
+    int value = 0;
+};
+
+// =================================================
+// SudokuStepSolver Class
+// =================================================
+
+class SudokuStepSolver
+{
+public:
+    // ------------------------------------------------------
+    // Constructor & Destructor
+    // ------------------------------------------------------
+    SudokuStepSolver();
+    ~SudokuStepSolver();
+
+    // ------------------------------------------------------
+    // Stepping
+    // ------------------------------------------------------
+    void start(const SudokuBoard& board);
+    bool step(SudokuSolveEvent& event);              // False once the final event was reported
+    SolveStatus advance(uint64_t maxEvents);         // Runs up to maxEvents steps (one time slice)
+    bool isFinished() const { return m_state == State::FINISHED; }
+
+    // ------------------------------------------------------
+    // Configuration & State
+    // ------------------------------------------------------
+    void setStrategy(SolverStrategy strategy) { m_strategy = strategy; }   // FIRST_EMPTY, otherwise MRV
+    const SudokuBoard& getBoard() const { return m_board; }
+    SolveStatus getStatus() const { return m_status; }
+    uint64_t getPlacementCount() const { return m_placements; }
+    uint64_t getBacktrackCount() const { return m_backtracks; }
+
+private:
+    enum class State
+    {
+        DESCEND,    // Pick the next empty cell
+        RESUME,     // Continue with the frame on top of the stack
+        FINISHED
+    };
+
+    struct Frame
+    {
+        uint8_t cell;
+        uint8_t placed;        // Value currently written, 0 = none
+        uint16_t remaining;    // Candidates not tried yet (bit v = digit v)
+    };
+
+    // ------------------------------------------------------
+    // Private Data Members
+    // ------------------------------------------------------
+    SudokuBoard m_board;
+    std::array<Frame, SUDOKU_CELLS> m_frames;
+    int m_depth;
+    State m_state;
+    SolveStatus m_status;
+    SolverStrategy m_strategy;
+    uint64_t m_placements;
+    uint64_t m_backtracks;
+
+    // ------------------------------------------------------
+    // Private Helper Methods
+    // ------------------------------------------------------
+    int selectCell() const;    // -1 when the board is full
+    bool finish(SolveStatus status, SudokuSolveEvent& event);
+};
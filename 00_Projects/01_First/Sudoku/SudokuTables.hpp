@@ -0,0 +1,154 @@
+/**
+ * @file SudokuTables.hpp
+ * @brief Compile-time unit and peer tables for the 9x9 grid
+ *
+ * This header generates, at compile time, the 27 units (rows, columns and
+ * boxes) with their cell indices, the unit membership of every cell and the
+ * 20 peers of every cell. Board, solver, hint engine and GUI iterate these
+ * tables instead of recomputing box coordinates in their loops.
+ *
+ * Cells are indexed row-major (cell = row * 9 + col); units are indexed
+ * 0-8 for rows, 9-17 for columns and 18-26 for boxes.
+ *
+ * It also holds the Zobrist keys used to hash board states.
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// =================================================
+// Table dimensions
+// =================================================
+
+inline constexpr int SUDOKU_CELLS = 81;
+inline constexpr int SUDOKU_UNITS = 27;
+inline constexpr int SUDOKU_UNIT_SIZE = 9;
+inline constexpr int SUDOKU_PEERS = 20;
+
+inline constexpr int ROW_UNIT_BASE = 0;
+inline constexpr int COL_UNIT_BASE = 9;
+inline constexpr int BOX_UNIT_BASE = 18;
+
+// =================================================
+// Table Structure
+// =================================================
+
+struct SudokuTables
+{
+    std::array<std::array<uint8_t, SUDOKU_UNIT_SIZE>, SUDOKU_UNITS> unitCells;  // Cells of each unit
+    std::array<std::array<uint8_t, 3>, SUDOKU_CELLS> cellUnits;                 // Row, column, box unit
+    std::array<std::array<uint8_t, SUDOKU_PEERS>, SUDOKU_CELLS> peers;          // Cells sharing a unit
+    std::array<uint8_t, SUDOKU_CELLS> cellRow;
+    std::array<uint8_t, SUDOKU_CELLS> cellCol;
+    std::array<uint8_t, SUDOKU_CELLS> cellBox;
+};
+
+// =================================================
+// Compile-time generation
+// =================================================
+
+constexpr SudokuTables makeSudokuTables()
+{
+    SudokuTables tables{};
+
+    // ------------------------------------------------------
+    // Cell coordinates and unit membership
+    // ------------------------------------------------------
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        int row = cell / 9;
+        int col = cell % 9;
+        int box = (row / 3) * 3 + col / 3;
+
+        tables.cellRow[cell] = static_cast<uint8_t>(row);
+        tables.cellCol[cell] = static_cast<uint8_t>(col);
+        tables.cellBox[cell] = static_cast<uint8_t>(box);
+
+        tables.cellUnits[cell][0] = static_cast<uint8_t>(ROW_UNIT_BASE + row);
+        tables.cellUnits[cell][1] = static_cast<uint8_t>(COL_UNIT_BASE + col);
+        tables.cellUnits[cell][2] = static_cast<uint8_t>(BOX_UNIT_BASE + box);
+    }
+
+    // ------------------------------------------------------
+    // Unit cell lists, in row-major order within each unit
+    // ------------------------------------------------------
+    std::array<int, SUDOKU_UNITS> filled{};
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        for (int i = 0; i < 3; ++i) {
+            int unit = tables.cellUnits[cell][i];
+            tables.unitCells[unit][filled[unit]++] = static_cast<uint8_t>(cell);
+        }
+    }
+
+    // ------------------------------------------------------
+    // Peers: every other cell sharing a row, column or box
+    // ------------------------------------------------------
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        int count = 0;
+
+        for (int other = 0; other < SUDOKU_CELLS; ++other) {
+            if (other == cell) {
+                continue;
+            }
+
+            if (tables.cellRow[other] == tables.cellRow[cell] ||
+                tables.cellCol[other] == tables.cellCol[cell] ||
+                tables.cellBox[other] == tables.cellBox[cell]) {
+                tables.peers[cell][count++] = static_cast<uint8_t>(other);
+            }
+        }
+    }
+
+    return tables;
+}
+
+inline constexpr SudokuTables SUDOKU_TABLES = makeSudokuTables();
+
+// =================================================
+// Zobrist keys
+// =================================================
+
+// ------------------------------------------------------
+// One key per (cell, value). Value 0 (empty) has key zero, so a
+// board's hash is the XOR of the keys of its filled cells and
+// changes by two XORs per cell write.
+// ------------------------------------------------------
+using SudokuZobristKeys = std::array<std::array<uint64_t, SUDOKU_UNIT_SIZE + 1>, SUDOKU_CELLS>;
+
+constexpr SudokuZobristKeys makeSudokuZobristKeys()
+{
+    SudokuZobristKeys keys{};
+    uint64_t state = 0x5D0C0E5A1B2C3D4Eull;
+
+    for (int cell = 0; cell < SUDOKU_CELLS; ++cell) {
+        for (int value = 1; value <= SUDOKU_UNIT_SIZE; ++value) {
+            // SplitMix64 step
+            state += 0x9E3779B97F4A7C15ull;
+            uint64_t z = state;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            keys[cell][value] = z ^ (z >> 31);
+        }
+    }
+
+    return keys;
+}
+
+inline constexpr SudokuZobristKeys SUDOKU_ZOBRIST = makeSudokuZobristKeys();
+
+// =================================================
+// Compile-time sanity checks
+// =================================================
+
+static_assert(SUDOKU_TABLES.unitCells[BOX_UNIT_BASE + 4][0] == 30, "Centre box starts at (3,3)");
+static_assert(SUDOKU_TABLES.unitCells[COL_UNIT_BASE + 8][8] == 80, "Last column ends at (8,8)");
+static_assert(SUDOKU_TABLES.peers[0][SUDOKU_PEERS - 1] == 72, "Last peer of (0,0) is (8,0)");
+static_assert(SUDOKU_TABLES.cellUnits[80][2] == BOX_UNIT_BASE + 8, "Cell (8,8) is in the last box");
+static_assert(SUDOKU_ZOBRIST[0][0] == 0 && SUDOKU_ZOBRIST[0][1] != SUDOKU_ZOBRIST[80][9], "Empty cells do not hash");
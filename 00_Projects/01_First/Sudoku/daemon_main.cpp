@@ -0,0 +1,58 @@
+/**
+ * @file daemon_main.cpp
+ * @brief Entry point for the Sudoku solver daemon
+ *
+ * This file starts SudokuDaemon on a Unix domain socket and runs it until
+ * the process receives SIGINT or SIGTERM.
+ *
+ * Usage: SudokuDaemon [socket-path] [workers] [pool-file]
+ *
+ * @author Salah-Eldin Hassen
+ * @date December 2025
+ * @version 1.0
+ * @project Sudoku Game - SW Diploma
+ */
+
+#include "SudokuDaemon.hpp"
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <pthread.h>
+
+// =================================================
+// Main Function
+// =================================================
+
+int main(int argc, char *argv[])
+{
+    SudokuDaemonConfig config;
+    config.socketPath = argc > 1 ? argv[1] : "/tmp/sudoku-daemon.sock";
+    config.workers = argc > 2 ? std::atoi(argv[2]) : 0;
+    config.poolFile = argc > 3 ? argv[3] : "";
+
+    // ------------------------------------------------------
+    // A client that disconnects mid-reply must not kill the
+    // daemon; the stop signals are collected below, so block
+    // them before any thread starts (threads inherit the mask)
+    // ------------------------------------------------------
+    std::signal(SIGPIPE, SIG_IGN);
+
+    sigset_t stopSignals;
+    sigemptyset(&stopSignals);
+    sigaddset(&stopSignals, SIGINT);
+    sigaddset(&stopSignals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stopSignals, nullptr);
+
+    SudokuDaemon daemon(config);
+    if (!daemon.start()) {
+        std::cerr << "Cannot listen on " << config.socketPath << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "Listening on " << config.socketPath << std::endl;
+
+    int signal = 0;
+    sigwait(&stopSignals, &signal);
+
+    daemon.stop();
+    return EXIT_SUCCESS;
+}